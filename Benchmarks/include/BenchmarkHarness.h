@@ -0,0 +1,146 @@
+// Morgen Hyde
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace Genetics {
+
+	// One measured benchmark, times are per operation and statistics are over samples
+	struct BenchmarkResult {
+
+		std::string m_name;
+
+		uint32_t m_populationSize;
+		uint32_t m_measureCount;
+
+		uint32_t m_samples;
+		uint32_t m_opsPerSample;
+
+		double m_meanNs;
+		double m_stdDevNs;
+		double m_minNs;
+		double m_maxNs;
+	};
+
+	struct BenchmarkSettings {
+
+		uint32_t m_warmupSamples;
+		uint32_t m_samples;
+
+		// Calibration target, ops per sample is chosen so a sample takes roughly this long
+		double m_targetSampleNs;
+	};
+
+	constexpr BenchmarkSettings DefaultBenchmarkSettings = { 3, 15, 2000000.0 };
+
+	// Fixed seed every benchmark starts from, change it and every baseline has to be regenerated
+	constexpr uint32_t BenchmarkSeed = 0x6D757369;
+
+	class BenchmarkHarness {
+
+	public:
+		BenchmarkHarness(const BenchmarkSettings& settings = DefaultBenchmarkSettings);
+		~BenchmarkHarness();
+
+		// Times body() repeatedly, calibrating how many calls make up one sample
+		template <typename Body>
+		void measure(const std::string& name, uint32_t populationSize, uint32_t measureCount, Body body);
+
+		// For operations that consume their input: setup() runs untimed before every call to body(),
+		// and one call to body() is counted as opsPerCall operations
+		template <typename Setup, typename Body>
+		void measureWithSetup(const std::string& name, uint32_t populationSize, uint32_t measureCount,
+			uint32_t opsPerCall, Setup setup, Body body);
+
+		__inline const std::vector<BenchmarkResult>& getResults() const { return m_results; }
+		__inline const BenchmarkSettings& getSettings() const { return m_settings; }
+
+		// Static so results combined from several harnesses can be written the same way
+		static void printTable(std::ostream& output, const std::vector<BenchmarkResult>& results);
+
+		static bool writeCSV(const std::string& filepath, const std::vector<BenchmarkResult>& results);
+		static bool readCSV(const std::string& filepath, std::vector<BenchmarkResult>& results);
+
+	private:
+		typedef std::chrono::steady_clock Clock;
+
+		void addResult(const std::string& name, uint32_t populationSize, uint32_t measureCount,
+			uint32_t opsPerSample, const std::vector<double>& sampleNs);
+
+		BenchmarkSettings m_settings;
+		std::vector<BenchmarkResult> m_results;
+		std::vector<double> m_sampleNs;
+	};
+
+	template <typename Body>
+	void BenchmarkHarness::measure(const std::string& name, uint32_t populationSize, uint32_t measureCount, Body body) {
+
+		// Calibrate by doubling the batch until it's long enough to time reliably, a single cold call
+		// overestimates cheap operations badly
+		uint32_t opsPerSample = 1;
+		double batchNs = 0.0;
+		Clock::time_point start;
+
+		while (true) {
+
+			start = Clock::now();
+			for (uint32_t op = 0; op < opsPerSample; ++op) {
+				body();
+			}
+			batchNs = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+
+			if (batchNs * 8.0 >= m_settings.m_targetSampleNs || opsPerSample >= (1u << 30)) {
+				break;
+			}
+			opsPerSample *= 2;
+		}
+
+		if (batchNs > 0.0 && batchNs < m_settings.m_targetSampleNs) {
+			opsPerSample = static_cast<uint32_t>(opsPerSample * (m_settings.m_targetSampleNs / batchNs));
+		}
+
+		m_sampleNs.clear();
+		for (uint32_t sample = 0; sample < m_settings.m_warmupSamples + m_settings.m_samples; ++sample) {
+
+			start = Clock::now();
+			for (uint32_t op = 0; op < opsPerSample; ++op) {
+				body();
+			}
+			double elapsedNs = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+
+			if (sample >= m_settings.m_warmupSamples) {
+				m_sampleNs.push_back(elapsedNs / opsPerSample);
+			}
+		}
+
+		addResult(name, populationSize, measureCount, opsPerSample, m_sampleNs);
+	}
+
+	template <typename Setup, typename Body>
+	void BenchmarkHarness::measureWithSetup(const std::string& name, uint32_t populationSize, uint32_t measureCount,
+		uint32_t opsPerCall, Setup setup, Body body) {
+
+		opsPerCall = (opsPerCall > 0) ? opsPerCall : 1;
+
+		m_sampleNs.clear();
+		for (uint32_t sample = 0; sample < m_settings.m_warmupSamples + m_settings.m_samples; ++sample) {
+
+			setup();
+
+			Clock::time_point start = Clock::now();
+			body();
+			double elapsedNs = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+
+			if (sample >= m_settings.m_warmupSamples) {
+				m_sampleNs.push_back(elapsedNs / opsPerCall);
+			}
+		}
+
+		addResult(name, populationSize, measureCount, opsPerCall, m_sampleNs);
+	}
+
+} // namespace Genetics
@@ -0,0 +1,23 @@
+// Morgen Hyde
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace Genetics {
+
+	class BenchmarkHarness;
+
+	// Phrase shapes every operator is timed at, subdivision is always 16ths
+	const std::vector<uint32_t> BenchmarkPopulationSizes = { 24, 96, 384 };
+	const std::vector<uint32_t> BenchmarkMeasureCounts   = { 2, 4, 8 };
+
+	constexpr uint32_t BenchmarkSubdivision = 16;
+
+	// Adds the benchmark rule set to the RuleManager, call once before running anything
+	void createBenchmarkRules();
+
+	// Selection, breeding, every mutation, every extractor, and every merge/replacement policy
+	void runOperatorBenchmarks(BenchmarkHarness& harness);
+
+} // namespace Genetics
@@ -0,0 +1,39 @@
+// Morgen Hyde
+#pragma once
+
+#include "BenchmarkHarness.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace Genetics {
+
+	struct RegressionThresholds {
+
+		// Slowdowns smaller than this fraction of the baseline are never reported
+		double m_maxSlowdown;
+
+		// Lower bound on how many standard errors the difference has to be before it counts. The
+		// bound actually used is the one-sided 99.5% Student's t value for the Welch degrees of
+		// freedom, which is much higher with only a few trials, so noisy benchmarks don't fail on a bad run
+		double m_minSignificance;
+	};
+
+	constexpr RegressionThresholds DefaultRegressionThresholds = { 0.10, 2.576 };
+
+	constexpr uint32_t DefaultRegressionTrials = 5;
+
+	// Only these groups fail the check, regressions anywhere else are reported as warnings
+	const std::vector<std::string> GatedBenchmarkPrefixes = { "Generation/", "Fitness/", "Extractor/", "IO/" };
+
+	// Collapses repeated runs of the same suite into one result per benchmark, the statistics
+	// are taken over the per-trial means so trial to trial noise is what gets measured
+	void combineTrials(const std::vector<std::vector<BenchmarkResult>>& trials, std::vector<BenchmarkResult>& combined);
+
+	// Prints a comparison of every benchmark found in both sets, returns the number of
+	// significant regressions in gated benchmarks. Gated benchmarks in the baseline that the
+	// current run doesn't have count as regressions too
+	uint32_t checkForRegressions(const std::vector<BenchmarkResult>& baseline, const std::vector<BenchmarkResult>& current,
+		const RegressionThresholds& thresholds = DefaultRegressionThresholds);
+
+} // namespace Genetics
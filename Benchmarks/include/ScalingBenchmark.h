@@ -0,0 +1,54 @@
+// Morgen Hyde
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace Genetics {
+
+	// One point on a scaling curve, everything the full algorithm is configured with
+	struct ScalingConfig {
+
+		uint32_t m_populationSize;
+		uint32_t m_measureCount;
+		uint32_t m_subdivision;
+
+		uint32_t m_rulesPerType;
+		uint32_t m_verticesPerFunction;
+
+		uint32_t m_threadCount; // Including the calling thread, 1 runs without any workers
+	};
+
+	struct ScalingResult {
+
+		std::string m_sweep; // Which parameter this point varies
+		ScalingConfig m_config;
+
+		uint32_t m_generations;
+
+		double m_initMs; // Generating and scoring the starting population
+		double m_runMs;  // The timed generations
+
+		double m_generationsPerSecond;
+		double m_childrenPerSecond;
+
+		float m_bestFitness;
+	};
+
+	// Centre of every sweep, each curve varies one parameter and holds the rest here
+	constexpr ScalingConfig BaselineScalingConfig = { 96, 4, 16, 4, 8, 0 };
+
+	constexpr uint32_t DefaultScalingGenerations = 25;
+
+	// Runs the full algorithm, headless and seeded, for a fixed number of generations
+	ScalingResult runScalingConfig(const std::string& sweep, const ScalingConfig& config, uint32_t generations);
+
+	// Population size, phrase length, rule count and thread count curves around the baseline
+	void runScalingBenchmarks(uint32_t generations, std::vector<ScalingResult>& results);
+
+	void printScalingTable(std::ostream& output, const std::vector<ScalingResult>& results);
+	bool writeScalingCSV(const std::string& filepath, const std::vector<ScalingResult>& results);
+
+} // namespace Genetics
@@ -0,0 +1,14 @@
+// Morgen Hyde
+#pragma once
+
+#include <cstdint>
+
+namespace Genetics {
+
+	// Replaces every rule in the RuleManager with a synthetic set: rulesPerType rules for each
+	// extractor type (capped at RULES_PER_TYPE), each with its own random function. The same
+	// seed always produces the same rule set. Export it with RuleManager::exportRules to get a
+	// file in the same format as Output/StressTest.xml.
+	void generateStressRules(uint32_t rulesPerType, uint32_t verticesPerFunction, uint32_t seed);
+
+} // namespace Genetics
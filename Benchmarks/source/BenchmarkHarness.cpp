@@ -0,0 +1,140 @@
+// Morgen Hyde
+
+#include "BenchmarkHarness.h"
+
+#include <algorithm> // std::min_element, std::max_element
+#include <cmath>     // std::sqrt
+#include <exception> // std::exception
+#include <fstream>   // std::ifstream, std::ofstream
+#include <iomanip>   // std::setw
+#include <iostream>  // std::cout
+#include <sstream>   // std::stringstream
+
+namespace Genetics {
+
+	BenchmarkHarness::BenchmarkHarness(const BenchmarkSettings& settings)
+		: m_settings(settings) {
+	}
+
+	BenchmarkHarness::~BenchmarkHarness() {
+	}
+
+	void BenchmarkHarness::addResult(const std::string& name, uint32_t populationSize, uint32_t measureCount,
+		uint32_t opsPerSample, const std::vector<double>& sampleNs) {
+
+		BenchmarkResult result = { name, populationSize, measureCount, static_cast<uint32_t>(sampleNs.size()), opsPerSample, 0.0, 0.0, 0.0, 0.0 };
+
+		if (!sampleNs.empty()) {
+
+			double sum = 0.0;
+			for (double sample : sampleNs) {
+				sum += sample;
+			}
+			result.m_meanNs = sum / sampleNs.size();
+
+			double squaredError = 0.0;
+			for (double sample : sampleNs) {
+				squaredError += (sample - result.m_meanNs) * (sample - result.m_meanNs);
+			}
+
+			// Sample standard deviation, these get compared against other runs later
+			result.m_stdDevNs = (sampleNs.size() > 1) ? std::sqrt(squaredError / (sampleNs.size() - 1)) : 0.0;
+			result.m_minNs = *std::min_element(sampleNs.begin(), sampleNs.end());
+			result.m_maxNs = *std::max_element(sampleNs.begin(), sampleNs.end());
+		}
+
+		m_results.push_back(result);
+
+		// Progress as we go, a full suite takes a while
+		std::cout << std::left << std::setw(40) << name << " N=" << std::setw(5) << populationSize;
+		std::cout << " M=" << std::setw(3) << measureCount << std::right << std::fixed << std::setprecision(1);
+		std::cout << std::setw(14) << result.m_meanNs << " ns/op  +/- " << result.m_stdDevNs << std::endl;
+	}
+
+	void BenchmarkHarness::printTable(std::ostream& output, const std::vector<BenchmarkResult>& results) {
+
+		output << std::left << std::setw(40) << "Benchmark" << std::setw(8) << "N" << std::setw(6) << "M";
+		output << std::right << std::setw(14) << "mean ns/op" << std::setw(14) << "stddev" << std::setw(14) << "min" << std::endl;
+
+		output << std::fixed << std::setprecision(1);
+		for (const BenchmarkResult& result : results) {
+
+			output << std::left << std::setw(40) << result.m_name << std::setw(8) << result.m_populationSize << std::setw(6) << result.m_measureCount;
+			output << std::right << std::setw(14) << result.m_meanNs << std::setw(14) << result.m_stdDevNs << std::setw(14) << result.m_minNs << std::endl;
+		}
+	}
+
+	bool BenchmarkHarness::writeCSV(const std::string& filepath, const std::vector<BenchmarkResult>& results) {
+
+		std::ofstream csvFile(filepath);
+		if (!csvFile.is_open()) {
+
+			std::cout << "Unable to open benchmark output " << filepath << std::endl;
+			return false;
+		}
+
+		csvFile << "benchmark,population,measures,samples,ops_per_sample,mean_ns,stddev_ns,min_ns,max_ns\n";
+		csvFile << std::fixed << std::setprecision(3);
+
+		for (const BenchmarkResult& result : results) {
+
+			csvFile << result.m_name << ',' << result.m_populationSize << ',' << result.m_measureCount << ',';
+			csvFile << result.m_samples << ',' << result.m_opsPerSample << ',';
+			csvFile << result.m_meanNs << ',' << result.m_stdDevNs << ',' << result.m_minNs << ',' << result.m_maxNs << '\n';
+		}
+
+		return true;
+	}
+
+	bool BenchmarkHarness::readCSV(const std::string& filepath, std::vector<BenchmarkResult>& results) {
+
+		std::ifstream csvFile(filepath);
+		if (!csvFile.is_open()) {
+
+			std::cout << "Unable to open benchmark file " << filepath << std::endl;
+			return false;
+		}
+
+		std::string line;
+		std::getline(csvFile, line); // Header
+		uint32_t lineNumber = 1;
+
+		while (std::getline(csvFile, line)) {
+
+			++lineNumber;
+			if (line.empty()) {
+				continue;
+			}
+
+			// Names never contain commas so a plain split is enough
+			std::stringstream lineStream(line);
+			std::string field;
+
+			BenchmarkResult result;
+			std::getline(lineStream, result.m_name, ',');
+
+			// Baselines get edited by hand, a field that isn't a number fails the read rather than the run
+			try {
+
+				std::getline(lineStream, field, ','); result.m_populationSize = std::stoul(field);
+				std::getline(lineStream, field, ','); result.m_measureCount = std::stoul(field);
+				std::getline(lineStream, field, ','); result.m_samples = std::stoul(field);
+				std::getline(lineStream, field, ','); result.m_opsPerSample = std::stoul(field);
+				std::getline(lineStream, field, ','); result.m_meanNs = std::stod(field);
+				std::getline(lineStream, field, ','); result.m_stdDevNs = std::stod(field);
+				std::getline(lineStream, field, ','); result.m_minNs = std::stod(field);
+				std::getline(lineStream, field, ','); result.m_maxNs = std::stod(field);
+			}
+			catch (const std::exception&) {
+
+				std::cout << filepath << " line " << lineNumber << ": \"" << field << "\" isn't a number" << std::endl;
+				return false;
+			}
+
+			results.push_back(result);
+		}
+
+		return true;
+	}
+
+} // namespace Genetics
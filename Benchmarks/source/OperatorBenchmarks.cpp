@@ -0,0 +1,325 @@
+// Morgen Hyde
+
+#include "OperatorBenchmarks.h"
+#include "BenchmarkHarness.h"
+
+#include "GAController.h"
+#include "Generation/PopulationGenerator.h"
+#include "Fitness/FitnessEvaluator.h"
+#include "Fitness/RuleExtractors.h"
+#include "Fitness/RuleManager.h"
+#include "Selection/Selector.h"
+#include "Breeding/Breeder.h"
+#include "Mutation/Mutator.h"
+#include "FIleIO/MIDIFiles.h"
+#include "Utility/TaskScheduler.h"
+#include "PhrasePool.h"
+#include "Phrase.h"
+#include "NoteEventList.h"
+
+#include <cstdio>  // std::remove
+#include <cstring> // std::memcpy, std::memset
+#include <random>  // std::mt19937
+#include <string>  // std::to_string
+
+namespace Genetics {
+
+	// Results get written here so the optimizer can't throw the timed work away
+	volatile float g_benchmarkSink = 0.0f;
+
+	const char* const ExtractorNames[ext_ExtractorCount] = { "Pitch", "Rhythm", "Interval", "Measure", "Chord" };
+
+	// Scratch files for the I/O benchmarks, written to the working directory and removed afterwards
+	const char* const BenchmarkMIDIPath = "benchmark_io.midi";
+	const char* const BenchmarkRulesPath = "benchmark_io.xml";
+
+	// Restores a phrase's genome from another phrase of the same shape without reallocating
+	void copyGenome(Phrase* destination, const Phrase* source) {
+
+		uint32_t arrayLen = source->_numMeasures * source->_smallestSubdivision;
+
+		std::memcpy(destination->_melodicData, source->_melodicData, arrayLen);
+		std::memcpy(destination->_melodicRhythm, source->_melodicRhythm, arrayLen);
+		destination->_melodicNotes = source->_melodicNotes;
+
+		std::memcpy(destination->_harmonicData, source->_harmonicData, source->_harmonicNotes * sizeof(Chord));
+		destination->_harmonicNotes = source->_harmonicNotes;
+
+		destination->_fitnessValue = source->_fitnessValue;
+	}
+
+	// Fills the child population with copies of the parents carrying new, reproducible fitness values
+	void createScoredChildren(PhrasePool* pool, uint32_t count, std::mt19937& engine) {
+
+		std::uniform_real_distribution<float> fitness(0.0f, 1.0f);
+		const std::vector<Phrase*>& parents = pool->GetPhrases();
+
+		for (uint32_t i = 0; i < count; ++i) {
+
+			Phrase* child = pool->AllocateChild();
+			if (child == nullptr) {
+				return;
+			}
+
+			copyGenome(child, parents[i % parents.size()]);
+			child->_fitnessValue = fitness(engine);
+		}
+	}
+
+	void createBenchmarkRules() {
+
+		RuleManager& ruleManager = RuleManager::getRuleManager();
+
+		// A function wide enough that every extractor lands inside it most of the time
+		FunctionID function = ruleManager.createNewFunction("Benchmark");
+		std::shared_ptr<Function> handle = ruleManager.getFunctionHandle(function);
+
+		for (short x = -64; x <= 64; x += 16) {
+			handle->addVertex(x, (x % 32 == 0) ? 1.0f : 0.25f);
+		}
+
+		for (RuleType type = ext_Pitch; type < ext_ExtractorCount; ++type) {
+			ruleManager.createRule(type, function);
+		}
+	}
+
+	void benchmarkFunctions(BenchmarkHarness& harness) {
+
+		const uint32_t vertexCounts[] = { 2, 8, 32 };
+		for (uint32_t vertexCount : vertexCounts) {
+
+			Function function("Benchmark", 0);
+
+			// Evenly spread over [-128, 128] so inputs hit every segment
+			short spacing = static_cast<short>(256 / (vertexCount - 1));
+			for (uint32_t vertex = 0; vertex < vertexCount; ++vertex) {
+				function.addVertex(static_cast<short>(-128 + vertex * spacing), (vertex & 1) ? 1.0f : 0.0f);
+			}
+
+			short input = -128;
+			harness.measure("Function/Evaluate" + std::to_string(vertexCount), 0, 0, [&function, &input]() {
+
+				g_benchmarkSink = g_benchmarkSink + function(input);
+				input = (input < 128) ? input + 1 : -128;
+			});
+		}
+	}
+
+	void benchmarkRuleIO(BenchmarkHarness& harness) {
+
+		RuleManager& ruleManager = RuleManager::getRuleManager();
+
+		harness.measure("IO/ExportRules", 0, 0, [&ruleManager]() {
+
+			ruleManager.exportRules(BenchmarkRulesPath);
+		});
+
+		// Importing replaces the rules with an identical copy of themselves, so later benchmarks see the same set
+		harness.measure("IO/ImportRules", 0, 0, [&ruleManager]() {
+
+			ruleManager.importRules(BenchmarkRulesPath);
+		});
+
+		std::remove(BenchmarkRulesPath);
+	}
+
+	void benchmarkGeneration(BenchmarkHarness& harness, uint32_t populationSize, uint32_t measureCount) {
+
+		GeneticAlgorithmController geneticAlgorithm;
+
+		geneticAlgorithm.setPhrasePoolSize(populationSize);
+		geneticAlgorithm.setPhraseShape(measureCount, BenchmarkSubdivision);
+		geneticAlgorithm.setIterationCount(1);
+		geneticAlgorithm.setSeed(BenchmarkSeed);
+
+		// Single threaded like everything else here, the scaling mode covers threading
+		TaskScheduler::getScheduler().shutdown();
+
+		geneticAlgorithm.clearPhrasePool();
+		geneticAlgorithm.initializeAlgorithm(false);
+
+		harness.measure("Generation/Run", populationSize, measureCount, [&geneticAlgorithm]() {
+
+			geneticAlgorithm.run();
+		});
+
+		geneticAlgorithm.shutdownAlgorithm();
+	}
+
+	void benchmarkShape(BenchmarkHarness& harness, uint32_t populationSize, uint32_t measureCount) {
+
+		PopulationGenerator generator(populationSize, { static_cast<int>(measureCount), static_cast<int>(BenchmarkSubdivision) });
+		generator.Seed(BenchmarkSeed);
+
+		PhrasePool* pool = generator.GeneratePopulation();
+		pool->SeedReplacement(BenchmarkSeed);
+
+		// The allocator holds twice the population, so a second one fits alongside the pool above
+		harness.measure("Generation/Populate", populationSize, measureCount, [&generator]() {
+
+			PhrasePool* generated = generator.GeneratePopulation();
+			delete generated;
+		});
+
+		// Real fitness values so the selection and merge policies see a realistic distribution
+		FitnessEvaluator<AutomaticFitness> evaluator;
+		evaluator.Assess(pool);
+
+		const std::vector<Phrase*>& population = pool->GetPhrases();
+		std::mt19937 engine(BenchmarkSeed);
+
+		// Selection //
+
+		Selection<RouletteSelection> roulette;
+		roulette.Seed(BenchmarkSeed);
+		harness.measure("Selection/Roulette", populationSize, measureCount, [&roulette, pool]() {
+
+			BreedingPair parents = roulette.SelectPair(pool);
+			g_benchmarkSink = g_benchmarkSink + parents.first->_fitnessValue;
+		});
+
+		Selection<TournamentSelection> tournament;
+		tournament.Seed(BenchmarkSeed);
+		harness.measure("Selection/Tournament", populationSize, measureCount, [&tournament, pool]() {
+
+			BreedingPair parents = tournament.SelectPair(pool);
+			g_benchmarkSink = g_benchmarkSink + parents.first->_fitnessValue;
+		});
+
+		// Breeding, includes allocating and freeing the children like a real generation does //
+
+		BreedingPair breedingPair(population[0], population[population.size() / 2]);
+
+		BreedingMethod<CrosspointBreed> crosspoint;
+		harness.measure("Breed/Crosspoint", populationSize, measureCount, [&crosspoint, &breedingPair, pool]() {
+
+			crosspoint.Breed(breedingPair, pool);
+			pool->ReleaseChildren();
+		});
+
+		BreedingMethod<InterpolateBreed> interpolate;
+		interpolate.Seed(BenchmarkSeed);
+		harness.measure("Breed/Interpolate", populationSize, measureCount, [&interpolate, &breedingPair, pool]() {
+
+			interpolate.Breed(breedingPair, pool);
+			pool->ReleaseChildren();
+		});
+
+		// Mutation, each operator runs on a fresh copy of the same phrase //
+
+		Phrase* mutationTemplate = population[0];
+		Phrase* workPhrase = pool->AllocateChild();
+
+		harness.measure("Mutation/Restore", populationSize, measureCount, [workPhrase, mutationTemplate]() {
+
+			copyGenome(workPhrase, mutationTemplate);
+		});
+
+		Mutator mutator;
+		mutator.InitMutationPool();
+		mutator.Seed(BenchmarkSeed);
+
+		for (unsigned mutation = 0; mutation < mutator.GetMutationCount(); ++mutation) {
+
+			harness.measure(std::string("Mutation/") + mutator.GetMutationName(mutation), populationSize, measureCount,
+				[&mutator, mutation, workPhrase, mutationTemplate]() {
+
+				copyGenome(workPhrase, mutationTemplate);
+				mutator.ApplyMutation(mutation, workPhrase);
+			});
+		}
+
+		pool->ReleaseChildren();
+
+		// Fitness, each extractor scores one phrase per op, cycling through the population //
+
+		std::vector<ExtractorBase*> extractors;
+		RuleManager::getRuleManager().createAllExtractors(extractors);
+
+		for (uint32_t type = 0; type < extractors.size(); ++type) {
+
+			ExtractorBase* extractor = extractors[type];
+			uint32_t phraseIndex = 0;
+			NoteEventList notes;
+
+			// Includes building the note list, which the evaluator shares across every extractor
+			harness.measure(std::string("Extractor/") + ExtractorNames[type], populationSize, measureCount,
+				[extractor, &population, &phraseIndex, &notes]() {
+
+				notes.build(population[phraseIndex]);
+				g_benchmarkSink = g_benchmarkSink + extractor->process(population[phraseIndex], notes);
+				phraseIndex = (phraseIndex + 1 < population.size()) ? phraseIndex + 1 : 0;
+			});
+
+			delete extractor;
+		}
+
+		harness.measure("Fitness/AssessPopulation", populationSize, measureCount, [&evaluator, pool]() {
+
+			evaluator.Assess(pool);
+		});
+
+		// Merging, a full generation of children per call //
+
+		harness.measureWithSetup("Merge/Elitist", populationSize, measureCount, 1,
+			[pool, populationSize, &engine]() { createScoredChildren(pool, populationSize, engine); },
+			[pool]() { pool->MergeChildrenToPopulation<ElitistPrune>(); });
+
+		harness.measureWithSetup("Merge/Generational", populationSize, measureCount, 1,
+			[pool, populationSize, &engine]() { createScoredChildren(pool, populationSize, engine); },
+			[pool]() { pool->MergeChildrenToPopulation<GenerationalPrune>(); });
+
+		// Steady state replacement, reported per child //
+
+		harness.measureWithSetup("Replace/Worst", populationSize, measureCount, populationSize,
+			[pool, populationSize, &engine]() { createScoredChildren(pool, populationSize, engine); },
+			[pool]() { while (pool->GetNumChildren() > 0) { pool->ReplaceIntoPopulation<ReplaceWorst>(); } });
+
+		harness.measureWithSetup("Replace/ReverseTournament", populationSize, measureCount, populationSize,
+			[pool, populationSize, &engine]() { createScoredChildren(pool, populationSize, engine); },
+			[pool]() { while (pool->GetNumChildren() > 0) { pool->ReplaceIntoPopulation<ReverseTournamentReplace>(); } });
+
+		// File I/O, a phrase round trip through a MIDI file //
+
+		// The merges above freed the old template, take whoever is at the front now
+		Phrase* midiSource = population[0];
+		Phrase* midiPhrase = pool->AllocateChild();
+		MIDIHandler midiHandler;
+
+		harness.measure("IO/WriteMIDI", populationSize, measureCount, [&midiHandler, midiSource]() {
+
+			midiHandler.writeToMIDI(midiSource, BenchmarkMIDIPath);
+		});
+
+		harness.measure("IO/ReadMIDI", populationSize, measureCount, [&midiHandler, midiPhrase, measureCount]() {
+
+			// Reading adds notes on top of whatever is there, same as the controller's import
+			std::memset(midiPhrase->_melodicData, 0, measureCount * BenchmarkSubdivision);
+			std::memset(midiPhrase->_melodicRhythm, 0, measureCount * BenchmarkSubdivision);
+			midiPhrase->_melodicNotes = 0;
+
+			midiHandler.readFromMIDI(midiPhrase, BenchmarkMIDIPath);
+		});
+
+		std::remove(BenchmarkMIDIPath);
+		pool->ReleaseChildren();
+
+		delete pool;
+
+		benchmarkGeneration(harness, populationSize, measureCount);
+	}
+
+	void runOperatorBenchmarks(BenchmarkHarness& harness) {
+
+		benchmarkFunctions(harness);
+		benchmarkRuleIO(harness);
+
+		for (uint32_t measureCount : BenchmarkMeasureCounts) {
+			for (uint32_t populationSize : BenchmarkPopulationSizes) {
+
+				benchmarkShape(harness, populationSize, measureCount);
+			}
+		}
+	}
+
+} // namespace Genetics
@@ -0,0 +1,207 @@
+// Morgen Hyde
+
+#include "RegressionCheck.h"
+
+#include <algorithm> // std::min, std::max
+#include <cmath>     // std::sqrt
+#include <iomanip>   // std::setw
+#include <iostream>  // std::cout
+#include <limits>    // std::numeric_limits
+
+namespace Genetics {
+
+	bool isGatedBenchmark(const std::string& name) {
+
+		for (const std::string& prefix : GatedBenchmarkPrefixes) {
+
+			if (name.compare(0, prefix.size(), prefix) == 0) {
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	// One-sided 99.5% critical values of Student's t, indexed by degrees of freedom
+	double studentCriticalValue(double degreesOfFreedom) {
+
+		struct CriticalValue {
+
+			double m_degreesOfFreedom;
+			double m_value;
+		};
+
+		static const CriticalValue table[] = {
+			{ 1, 63.657 }, { 2, 9.925 }, { 3, 5.841 }, { 4, 4.604 }, { 5, 4.032 }, { 6, 3.707 }, { 7, 3.499 },
+			{ 8, 3.355 }, { 9, 3.250 }, { 10, 3.169 }, { 12, 3.055 }, { 15, 2.947 }, { 20, 2.845 }, { 30, 2.750 }
+		};
+
+		// Round down to the next listed value, that only ever makes the check stricter
+		double critical = table[0].m_value;
+		for (const CriticalValue& entry : table) {
+
+			if (degreesOfFreedom < entry.m_degreesOfFreedom) {
+				return critical;
+			}
+			critical = entry.m_value;
+		}
+
+		return (degreesOfFreedom >= 120.0) ? 2.576 : critical;
+	}
+
+	const BenchmarkResult* findMatchingResult(const std::vector<BenchmarkResult>& results, const BenchmarkResult& target) {
+
+		for (const BenchmarkResult& result : results) {
+
+			if (result.m_name == target.m_name && result.m_populationSize == target.m_populationSize &&
+				result.m_measureCount == target.m_measureCount) {
+				return &result;
+			}
+		}
+
+		return nullptr;
+	}
+
+	void combineTrials(const std::vector<std::vector<BenchmarkResult>>& trials, std::vector<BenchmarkResult>& combined) {
+
+		combined.clear();
+		if (trials.empty()) {
+			return;
+		}
+
+		// A single trial keeps its within-trial statistics, there's nothing to combine
+		if (trials.size() == 1) {
+
+			combined = trials.front();
+			return;
+		}
+
+		// Every trial runs the same suite in the same order
+		uint32_t trialCount = static_cast<uint32_t>(trials.size());
+		for (uint32_t index = 0; index < trials.front().size(); ++index) {
+
+			BenchmarkResult result = trials.front()[index];
+
+			double sum = 0.0;
+			for (const std::vector<BenchmarkResult>& trial : trials) {
+
+				sum += trial[index].m_meanNs;
+				result.m_minNs = std::min(result.m_minNs, trial[index].m_minNs);
+				result.m_maxNs = std::max(result.m_maxNs, trial[index].m_maxNs);
+			}
+			result.m_meanNs = sum / trialCount;
+
+			double squaredError = 0.0;
+			for (const std::vector<BenchmarkResult>& trial : trials) {
+				squaredError += (trial[index].m_meanNs - result.m_meanNs) * (trial[index].m_meanNs - result.m_meanNs);
+			}
+
+			result.m_stdDevNs = std::sqrt(squaredError / (trialCount - 1));
+			result.m_samples = trialCount;
+
+			combined.push_back(result);
+		}
+	}
+
+	uint32_t checkForRegressions(const std::vector<BenchmarkResult>& baseline, const std::vector<BenchmarkResult>& current,
+		const RegressionThresholds& thresholds) {
+
+		uint32_t regressions = 0;
+		uint32_t warnings = 0;
+		uint32_t improvements = 0;
+		uint32_t unmatched = 0;
+
+		std::cout << std::left << std::setw(40) << "Benchmark" << std::setw(8) << "N" << std::setw(6) << "M";
+		std::cout << std::right << std::setw(14) << "baseline ns" << std::setw(14) << "current ns";
+		std::cout << std::setw(10) << "change" << std::setw(10) << "t" << "  result" << std::endl;
+
+		for (const BenchmarkResult& result : current) {
+
+			// New benchmarks have nothing to compare against until the baseline is regenerated
+			const BenchmarkResult* reference = findMatchingResult(baseline, result);
+			if (reference == nullptr || reference->m_meanNs <= 0.0) {
+
+				++unmatched;
+				continue;
+			}
+
+			double change = (result.m_meanNs - reference->m_meanNs) / reference->m_meanNs;
+
+			// Welch's t test on the two means, the sample counts come from the files
+			double referenceSamples = std::max(reference->m_samples, 2u);
+			double resultSamples = std::max(result.m_samples, 2u);
+
+			double referenceVariance = (reference->m_stdDevNs * reference->m_stdDevNs) / referenceSamples;
+			double resultVariance = (result.m_stdDevNs * result.m_stdDevNs) / resultSamples;
+			double standardError = std::sqrt(referenceVariance + resultVariance);
+
+			double degreesOfFreedom = 1.0;
+			if (standardError > 0.0) {
+
+				degreesOfFreedom = (referenceVariance + resultVariance) * (referenceVariance + resultVariance) /
+					(referenceVariance * referenceVariance / (referenceSamples - 1.0) + resultVariance * resultVariance / (resultSamples - 1.0));
+			}
+
+			double criticalValue = std::max(thresholds.m_minSignificance, studentCriticalValue(degreesOfFreedom));
+
+			double significance = 0.0;
+			if (standardError > 0.0) {
+				significance = (result.m_meanNs - reference->m_meanNs) / standardError;
+			}
+			else if (result.m_meanNs != reference->m_meanNs) {
+				significance = (change > 0.0) ? std::numeric_limits<double>::infinity() : -std::numeric_limits<double>::infinity();
+			}
+
+			const char* verdict = "ok";
+			if (change > thresholds.m_maxSlowdown && significance > criticalValue) {
+
+				if (isGatedBenchmark(result.m_name)) {
+					verdict = "REGRESSION";
+					++regressions;
+				}
+				else {
+					verdict = "slower";
+					++warnings;
+				}
+			}
+			else if (change < -thresholds.m_maxSlowdown && significance < -criticalValue) {
+
+				verdict = "faster";
+				++improvements;
+			}
+
+			std::cout << std::left << std::setw(40) << result.m_name << std::setw(8) << result.m_populationSize << std::setw(6) << result.m_measureCount;
+			std::cout << std::right << std::fixed << std::setprecision(1) << std::setw(14) << reference->m_meanNs << std::setw(14) << result.m_meanNs;
+			std::cout << std::setw(9) << change * 100.0 << '%' << std::setw(10) << significance << "  " << verdict << std::endl;
+		}
+
+		// A gated benchmark that stopped running would otherwise pass the check without being timed
+		uint32_t missing = 0;
+		for (const BenchmarkResult& reference : baseline) {
+
+			if (findMatchingResult(current, reference) != nullptr) {
+				continue;
+			}
+
+			const char* verdict = "missing";
+			if (isGatedBenchmark(reference.m_name)) {
+				verdict = "MISSING";
+				++regressions;
+			}
+			else {
+				++warnings;
+			}
+			++missing;
+
+			std::cout << std::left << std::setw(40) << reference.m_name << std::setw(8) << reference.m_populationSize << std::setw(6) << reference.m_measureCount;
+			std::cout << std::right << std::fixed << std::setprecision(1) << std::setw(14) << reference.m_meanNs << std::setw(14) << "-";
+			std::cout << std::setw(10) << "-" << std::setw(10) << "-" << "  " << verdict << std::endl;
+		}
+
+		std::cout << std::endl << regressions << " regression(s), " << warnings << " warning(s), ";
+		std::cout << improvements << " improvement(s), " << unmatched << " not in the baseline, " << missing << " missing from this run" << std::endl;
+
+		return regressions;
+	}
+
+} // namespace Genetics
@@ -0,0 +1,167 @@
+// Morgen Hyde
+
+#include "ScalingBenchmark.h"
+#include "BenchmarkHarness.h"
+#include "StressRules.h"
+
+#include "GAController.h"
+#include "Phrase.h"
+#include "Utility/TaskScheduler.h"
+
+#include <chrono>   // std::chrono::steady_clock
+#include <fstream>  // std::ofstream
+#include <iomanip>  // std::setw
+#include <iostream> // std::cout
+#include <thread>   // std::thread::hardware_concurrency
+
+namespace Genetics {
+
+	ScalingResult runScalingConfig(const std::string& sweep, const ScalingConfig& config, uint32_t generations) {
+
+		typedef std::chrono::steady_clock Clock;
+
+		// Extractors copy the rules when the evaluator is built, so the rules have to exist before the controller
+		generateStressRules(config.m_rulesPerType, config.m_verticesPerFunction, BenchmarkSeed);
+
+		GeneticAlgorithmController geneticAlgorithm;
+
+		// The controller always starts workers, a single thread means running with none at all
+		if (config.m_threadCount > 1) {
+			geneticAlgorithm.setWorkerCount(config.m_threadCount - 1);
+		}
+		else {
+			TaskScheduler::getScheduler().shutdown();
+		}
+
+		geneticAlgorithm.setPhrasePoolSize(config.m_populationSize);
+		geneticAlgorithm.setPhraseShape(config.m_measureCount, config.m_subdivision);
+		geneticAlgorithm.setIterationCount(generations);
+		geneticAlgorithm.setSeed(BenchmarkSeed);
+
+		Clock::time_point start = Clock::now();
+		geneticAlgorithm.clearPhrasePool();
+		double initMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+		geneticAlgorithm.initializeAlgorithm(false);
+
+		start = Clock::now();
+		geneticAlgorithm.run();
+		double runMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+		// Children come from telemetry rather than population * generations so steady state counts correctly
+		const TelemetryRecorder& telemetry = geneticAlgorithm.getTelemetry();
+
+		uint64_t childCount = 0;
+		for (uint32_t record = 0; record < telemetry.size(); ++record) {
+			childCount += telemetry.getRecord(record).m_childrenProduced;
+		}
+
+		ScalingResult result;
+		result.m_sweep = sweep;
+		result.m_config = config;
+		result.m_generations = geneticAlgorithm.getTotalGenerations();
+		result.m_initMs = initMs;
+		result.m_runMs = runMs;
+		result.m_generationsPerSecond = (runMs > 0.0) ? result.m_generations * 1000.0 / runMs : 0.0;
+		result.m_childrenPerSecond = (runMs > 0.0) ? childCount * 1000.0 / runMs : 0.0;
+		result.m_bestFitness = geneticAlgorithm.getActivePhrase()->_fitnessValue;
+
+		geneticAlgorithm.shutdownAlgorithm();
+
+		std::cout << std::left << std::setw(12) << sweep << " N=" << std::setw(5) << config.m_populationSize;
+		std::cout << " M=" << std::setw(3) << config.m_measureCount << " R=" << std::setw(3) << config.m_rulesPerType;
+		std::cout << " T=" << std::setw(3) << config.m_threadCount << std::right << std::fixed << std::setprecision(1);
+		std::cout << std::setw(12) << result.m_childrenPerSecond << " children/s" << std::endl;
+
+		return result;
+	}
+
+	void runScalingBenchmarks(uint32_t generations, std::vector<ScalingResult>& results) {
+
+		uint32_t hardwareThreads = std::thread::hardware_concurrency();
+		hardwareThreads = (hardwareThreads > 0) ? hardwareThreads : 1;
+
+		ScalingConfig baseline = BaselineScalingConfig;
+		baseline.m_threadCount = hardwareThreads;
+
+		const uint32_t populationSizes[] = { 24, 48, 96, 192, 384, 768 };
+		for (uint32_t populationSize : populationSizes) {
+
+			ScalingConfig config = baseline;
+			config.m_populationSize = populationSize;
+			results.push_back(runScalingConfig("population", config, generations));
+		}
+
+		const uint32_t measureCounts[] = { 1, 2, 4, 8, 16 };
+		for (uint32_t measureCount : measureCounts) {
+
+			ScalingConfig config = baseline;
+			config.m_measureCount = measureCount;
+			results.push_back(runScalingConfig("measures", config, generations));
+		}
+
+		const uint32_t ruleCounts[] = { 1, 2, 4, 8, 16 };
+		for (uint32_t ruleCount : ruleCounts) {
+
+			ScalingConfig config = baseline;
+			config.m_rulesPerType = ruleCount;
+			results.push_back(runScalingConfig("rules", config, generations));
+		}
+
+		// Powers of two up to the machine, plus the machine itself if it isn't one
+		for (uint32_t threadCount = 1; threadCount <= hardwareThreads; threadCount *= 2) {
+
+			ScalingConfig config = baseline;
+			config.m_threadCount = threadCount;
+			results.push_back(runScalingConfig("threads", config, generations));
+
+			if (threadCount < hardwareThreads && threadCount * 2 > hardwareThreads) {
+
+				config.m_threadCount = hardwareThreads;
+				results.push_back(runScalingConfig("threads", config, generations));
+			}
+		}
+	}
+
+	void printScalingTable(std::ostream& output, const std::vector<ScalingResult>& results) {
+
+		output << std::left << std::setw(12) << "Sweep" << std::setw(7) << "N" << std::setw(5) << "M";
+		output << std::setw(5) << "R" << std::setw(5) << "T" << std::right << std::setw(12) << "init ms";
+		output << std::setw(12) << "gen/s" << std::setw(14) << "children/s" << std::endl;
+
+		output << std::fixed << std::setprecision(1);
+		for (const ScalingResult& result : results) {
+
+			const ScalingConfig& config = result.m_config;
+			output << std::left << std::setw(12) << result.m_sweep << std::setw(7) << config.m_populationSize << std::setw(5) << config.m_measureCount;
+			output << std::setw(5) << config.m_rulesPerType << std::setw(5) << config.m_threadCount << std::right << std::setw(12) << result.m_initMs;
+			output << std::setw(12) << result.m_generationsPerSecond << std::setw(14) << result.m_childrenPerSecond << std::endl;
+		}
+	}
+
+	bool writeScalingCSV(const std::string& filepath, const std::vector<ScalingResult>& results) {
+
+		std::ofstream csvFile(filepath);
+		if (!csvFile.is_open()) {
+
+			std::cout << "Unable to open scaling output " << filepath << std::endl;
+			return false;
+		}
+
+		csvFile << "sweep,population,measures,subdivision,rules_per_type,vertices,threads,generations,";
+		csvFile << "init_ms,run_ms,generations_per_sec,children_per_sec,best_fitness\n";
+		csvFile << std::fixed << std::setprecision(3);
+
+		for (const ScalingResult& result : results) {
+
+			const ScalingConfig& config = result.m_config;
+			csvFile << result.m_sweep << ',' << config.m_populationSize << ',' << config.m_measureCount << ',' << config.m_subdivision << ',';
+			csvFile << config.m_rulesPerType << ',' << config.m_verticesPerFunction << ',' << config.m_threadCount << ',' << result.m_generations << ',';
+			csvFile << result.m_initMs << ',' << result.m_runMs << ',' << result.m_generationsPerSecond << ',';
+			csvFile << result.m_childrenPerSecond << ',' << result.m_bestFitness << '\n';
+		}
+
+		return true;
+	}
+
+} // namespace Genetics
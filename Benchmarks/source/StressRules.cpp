@@ -0,0 +1,54 @@
+// Morgen Hyde
+
+#include "StressRules.h"
+
+#include "Fitness/RuleManager.h"
+#include "Fitness/FunctionBuilder.h"
+
+#include <random>    // std::mt19937
+#include <string>    // std::to_string
+
+namespace Genetics {
+
+	// Every extractor's inputs fall inside this range for 16th note phrases
+	constexpr short StressFunctionMinX = -64;
+	constexpr short StressFunctionMaxX = 64;
+
+	void generateStressRules(uint32_t rulesPerType, uint32_t verticesPerFunction, uint32_t seed) {
+
+		RuleManager& ruleManager = RuleManager::getRuleManager();
+		ruleManager.clearRules();
+
+		rulesPerType = (rulesPerType < RULES_PER_TYPE) ? rulesPerType : RULES_PER_TYPE;
+		verticesPerFunction = (verticesPerFunction > 2) ? verticesPerFunction : 2;
+
+		std::mt19937 engine(seed);
+		std::uniform_real_distribution<float> height(0.0f, 1.0f);
+
+		// Vertices are spread evenly with some jitter so every function covers the whole range
+		short spacing = static_cast<short>((StressFunctionMaxX - StressFunctionMinX) / (verticesPerFunction - 1));
+		spacing = (spacing > 0) ? spacing : 1;
+		std::uniform_int_distribution<short> jitter(0, (spacing > 2) ? spacing / 2 - 1 : 0);
+
+		for (RuleType type = ext_Pitch; type < ext_ExtractorCount; ++type) {
+			for (uint32_t rule = 0; rule < rulesPerType; ++rule) {
+
+				FunctionID functionID = ruleManager.createNewFunction("Stress" + std::to_string(type) + "_" + std::to_string(rule));
+				std::shared_ptr<Function> function = ruleManager.getFunctionHandle(functionID);
+
+				for (uint32_t vertex = 0; vertex < verticesPerFunction; ++vertex) {
+
+					short x = static_cast<short>(StressFunctionMinX + vertex * spacing);
+					if (vertex > 0 && vertex + 1 < verticesPerFunction) {
+						x += jitter(engine);
+					}
+
+					function->addVertex(x, height(engine));
+				}
+
+				ruleManager.createRule(type, functionID);
+			}
+		}
+	}
+
+} // namespace Genetics
@@ -0,0 +1,172 @@
+/*
+** Author  - Morgen Hyde
+** Project - MusicGenetics
+*/
+
+// Micro-benchmarks for the genetic operators and fitness kernels. Everything runs single
+// threaded from fixed seeds on synthetic populations, so two runs on the same machine time
+// exactly the same work and the CSV output can be diffed between builds.
+//
+// --check compares repeated trials against a baseline CSV written by an earlier run and
+// exits non-zero if a gated benchmark got significantly slower.
+//
+// --scaling runs the whole algorithm instead, against generated stress rule sets, and
+// reports throughput curves over population size, phrase length, rule count and threads.
+//
+// The project compiles the GeneticMusic sources straight in rather than linking a library.
+// Generation/Populate and --scaling drive a whole GeneticAlgorithmController, so the controller
+// and AudioPlayback come along and PortAudio is linked, though nothing is ever played.
+
+#include "BenchmarkHarness.h"
+#include "OperatorBenchmarks.h"
+#include "RegressionCheck.h"
+#include "ScalingBenchmark.h"
+#include "StressRules.h"
+
+#include "Fitness/RuleManager.h"
+
+#include <iostream> // std::cout
+#include <cstring>  // std::strcmp
+#include <cstdlib>  // std::strtoul
+#include <string>
+
+namespace Genetics {
+
+	void printUsage() {
+
+		std::cout << "Usage: Benchmarks [--output file.csv] [--samples N] [--trials N]" << std::endl;
+		std::cout << "       Benchmarks --check baseline.csv [--trials N] [--tolerance percent] [--output file.csv]" << std::endl;
+		std::cout << "       Benchmarks --scaling [--output file.csv] [--generations N]" << std::endl;
+		std::cout << "       Benchmarks --stress-rules file.xml [--rules N] [--vertices N]" << std::endl;
+	}
+
+} // namespace Genetics
+
+int main(int argc, char** argv) {
+
+	std::string outputPath;
+	std::string stressRulesPath;
+	std::string baselinePath;
+	bool scaling = false;
+
+	uint32_t trials = 0;
+	Genetics::RegressionThresholds thresholds = Genetics::DefaultRegressionThresholds;
+
+	uint32_t generations = Genetics::DefaultScalingGenerations;
+	uint32_t stressRules = Genetics::RULES_PER_TYPE;
+	uint32_t stressVertices = 32;
+
+	Genetics::BenchmarkSettings settings = Genetics::DefaultBenchmarkSettings;
+
+	for (int i = 1; i < argc; ++i) {
+
+		const char* arg = argv[i];
+		bool hasValue = (i + 1 < argc);
+
+		if (std::strcmp(arg, "--output") == 0 && hasValue) {
+			outputPath = argv[++i];
+		}
+		else if (std::strcmp(arg, "--samples") == 0 && hasValue) {
+			settings.m_samples = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+		}
+		else if (std::strcmp(arg, "--trials") == 0 && hasValue) {
+			trials = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+		}
+		else if (std::strcmp(arg, "--check") == 0 && hasValue) {
+			baselinePath = argv[++i];
+		}
+		else if (std::strcmp(arg, "--tolerance") == 0 && hasValue) {
+			thresholds.m_maxSlowdown = std::strtod(argv[++i], nullptr) / 100.0;
+		}
+		else if (std::strcmp(arg, "--scaling") == 0) {
+			scaling = true;
+		}
+		else if (std::strcmp(arg, "--generations") == 0 && hasValue) {
+			generations = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+		}
+		else if (std::strcmp(arg, "--stress-rules") == 0 && hasValue) {
+			stressRulesPath = argv[++i];
+		}
+		else if (std::strcmp(arg, "--rules") == 0 && hasValue) {
+			stressRules = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+		}
+		else if (std::strcmp(arg, "--vertices") == 0 && hasValue) {
+			stressVertices = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+		}
+		else {
+
+			std::cout << "Unrecognized argument: " << arg << std::endl;
+			Genetics::printUsage();
+			return 1;
+		}
+	}
+
+	// Just write a generated rule set out, it can be loaded in the rule editor or with --rules
+	if (!stressRulesPath.empty()) {
+
+		Genetics::generateStressRules(stressRules, stressVertices, Genetics::BenchmarkSeed);
+		return Genetics::RuleManager::getRuleManager().exportRules(stressRulesPath) ? 0 : 1;
+	}
+
+	if (scaling) {
+
+		std::vector<Genetics::ScalingResult> results;
+		Genetics::runScalingBenchmarks(generations, results);
+
+		std::cout << std::endl;
+		Genetics::printScalingTable(std::cout, results);
+
+		return Genetics::writeScalingCSV(outputPath.empty() ? "scaling.csv" : outputPath, results) ? 0 : 1;
+	}
+
+	if (settings.m_samples < 2) {
+		settings.m_samples = 2;
+	}
+
+	// Load the baseline before spending minutes on the benchmarks
+	std::vector<Genetics::BenchmarkResult> baseline;
+	bool checking = !baselinePath.empty();
+	if (checking && !Genetics::BenchmarkHarness::readCSV(baselinePath, baseline)) {
+		return 1;
+	}
+
+	if (trials == 0) {
+		trials = checking ? Genetics::DefaultRegressionTrials : 1;
+	}
+
+	Genetics::createBenchmarkRules();
+
+	std::vector<std::vector<Genetics::BenchmarkResult>> trialResults;
+	for (uint32_t trial = 0; trial < trials; ++trial) {
+
+		if (trials > 1) {
+			std::cout << "Trial " << trial + 1 << " of " << trials << std::endl;
+		}
+
+		Genetics::BenchmarkHarness harness(settings);
+		Genetics::runOperatorBenchmarks(harness);
+
+		trialResults.push_back(harness.getResults());
+	}
+
+	std::vector<Genetics::BenchmarkResult> results;
+	Genetics::combineTrials(trialResults, results);
+
+	std::cout << std::endl;
+	Genetics::BenchmarkHarness::printTable(std::cout, results);
+
+	if (!outputPath.empty() || !checking) {
+
+		if (!Genetics::BenchmarkHarness::writeCSV(outputPath.empty() ? "benchmarks.csv" : outputPath, results)) {
+			return 1;
+		}
+	}
+
+	if (checking) {
+
+		std::cout << std::endl;
+		return (Genetics::checkForRegressions(baseline, results, thresholds) > 0) ? 1 : 0;
+	}
+
+	return 0;
+}
@@ -1,78 +1,69 @@
-#pragma once
-
-#include <random>
-#include <utility>
-
-#include "PhrasePool.h"
-
-namespace Genetics {
-
-	struct Phrase;
-	typedef std::pair<Phrase*, Phrase*> BreedingPair;
-
-	struct CrosspointBreed {
-
-		CrosspointBreed() 
-			: m_tempBuffer(new char[256]), m_tempBufferSize(256) { 
-		}
-
-		~CrosspointBreed() { 
-
-			if (m_tempBuffer != nullptr) {
-
-				delete[] m_tempBuffer; m_tempBuffer = nullptr;
-			}
-		}
-
-	protected:
-		void CreateChildren(const BreedingPair& parents, PhrasePool* phrasePool);
-
-	private:
-		char* m_tempBuffer;
-		unsigned m_tempBufferSize;
-	};
-
-	struct InterpolateBreed {
-
-	protected:
-		InterpolateBreed() {
-
-			std::random_device rd; m_randomEngine.seed(rd());
-		}
-
-		void CreateChildren(const BreedingPair& parents, PhrasePool* phrasePool);
-	
-	private:
-		std::mt19937 m_randomEngine;
-	};
-
-	template <class Policy>
-	class BreedingMethod : public Policy {
-
-	public:
-		BreedingMethod();
-		virtual ~BreedingMethod();
-
-		void Breed(const BreedingPair& parents, PhrasePool* phrasePool);
-
-	private:
-		std::mt19937 m_randomEngine;
-		char* m_tempBuffer;
-	};
-
-	template <class Policy>
-	BreedingMethod<Policy>::BreedingMethod() {
-	}
-
-	template <class Policy>
-	BreedingMethod<Policy>::~BreedingMethod() {
-	}
-	
-	template <class Policy>
-	void BreedingMethod<Policy>::Breed(const BreedingPair& parents, PhrasePool* phrasePool) {
-
-		Policy::CreateChildren(parents, phrasePool);
-	}
-
-
+#pragma once
+
+#include <random>
+#include <utility>
+
+#include "PhrasePool.h"
+
+namespace Genetics {
+
+	struct Phrase;
+	typedef std::pair<Phrase*, Phrase*> BreedingPair;
+
+	struct CrosspointBreed {
+
+		// Deterministic already, present so every policy can be seeded the same way
+		void Seed(uint32_t seed) { }
+		std::mt19937* GetRandomEngine() { return nullptr; }
+
+	protected:
+		void CreateChildren(const BreedingPair& parents, PhrasePool* phrasePool);
+	};
+
+	struct InterpolateBreed {
+
+		void Seed(uint32_t seed) { m_randomEngine.seed(seed); }
+		std::mt19937* GetRandomEngine() { return &m_randomEngine; }
+
+	protected:
+		InterpolateBreed() {
+
+			std::random_device rd; m_randomEngine.seed(rd());
+		}
+
+		void CreateChildren(const BreedingPair& parents, PhrasePool* phrasePool);
+	
+	private:
+		std::mt19937 m_randomEngine;
+	};
+
+	template <class Policy>
+	class BreedingMethod : public Policy {
+
+	public:
+		BreedingMethod();
+		virtual ~BreedingMethod();
+
+		void Breed(const BreedingPair& parents, PhrasePool* phrasePool);
+
+	private:
+		std::mt19937 m_randomEngine;
+		char* m_tempBuffer;
+	};
+
+	template <class Policy>
+	BreedingMethod<Policy>::BreedingMethod() {
+	}
+
+	template <class Policy>
+	BreedingMethod<Policy>::~BreedingMethod() {
+	}
+	
+	template <class Policy>
+	void BreedingMethod<Policy>::Breed(const BreedingPair& parents, PhrasePool* phrasePool) {
+
+		Policy::CreateChildren(parents, phrasePool);
+	}
+
+
 } // namespace Genetics
\ No newline at end of file
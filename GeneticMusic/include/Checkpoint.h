@@ -0,0 +1,157 @@
+// Morgen Hyde
+#pragma once
+
+#include "Utility/MappedFile.h"
+
+#include <vector>
+#include <string>
+#include <random>
+#include <cstdint>
+
+namespace Genetics {
+
+	struct Phrase;
+
+	// Random engines saved with the population, in file order
+	enum CheckpointEngine {
+
+		engine_Generator = 0,
+		engine_Selection,
+		engine_Breeding,
+		engine_Mutation,
+		engine_Replacement,
+		engine_Count
+	};
+
+	// Binary layout, every offset is from the start of the file and 8 byte aligned:
+	//   CheckpointHeader
+	//   m_engineCount CheckpointEngineState blocks at m_engineOffset
+	//   m_phraseCount phrase records starting at m_phraseOffset
+	//   m_phraseCount uint64_t record offsets at m_indexOffset
+	// Records are packed so their sizes vary, the index lets phrase i be read straight out of a
+	// mapped file without walking the ones before it. Opening one checks every record's header
+	// against the index before anything is restored.
+	// Files written with fixed records hold every phrase as a grid record of m_maxRecordSize bytes
+	// instead, so phrase i sits at m_phraseOffset + i * m_maxRecordSize. Those are mapped with only
+	// the header checked and nothing parsed until a phrase is copied out, for 2-4 times the size
+	// on disk. The index is written either way
+	struct CheckpointHeader {
+
+		char m_magic[4];          // "GMCP"
+		uint32_t m_version;
+		uint32_t m_byteOrder;     // CheckpointByteOrder as written, a swapped value means the writer had the other endianness
+		uint32_t m_headerSize;    // sizeof(CheckpointHeader) when written
+
+		// Phrase shape, every record is packed against it
+		uint32_t m_measureCount;
+		uint32_t m_subdivision;
+		uint32_t m_maxRecordSize; // getCheckpointRecordSize for the shape
+
+		uint32_t m_phraseCount;
+		uint32_t m_generation;
+		uint32_t m_nextPhraseID;
+
+		// Fixed seed of the run, only meaningful if m_seeded is set
+		uint32_t m_seed;
+		uint32_t m_seeded;
+
+		uint32_t m_engineCount;
+		uint32_t m_fixedRecords;  // Nonzero if every record is a grid record of m_maxRecordSize bytes
+
+		uint64_t m_engineOffset;
+		uint64_t m_phraseOffset;
+		uint64_t m_indexOffset;
+		uint64_t m_fileSize;
+	};
+
+	// The standard library only exposes an engine's state through its stream operators, the words
+	// are stored as they come out so the state round trips exactly on the same standard library
+	constexpr uint32_t CheckpointEngineWords = std::mt19937::state_size + 1;
+
+	struct CheckpointEngineState {
+
+		uint32_t m_wordCount;
+		uint32_t m_words[CheckpointEngineWords];
+	};
+
+	// Followed by the packed genome (see PackedGenome.h) holding m_packedNotes notes, or for
+	// phrases that can't be packed the grid itself: melodic data and rhythm (measures * subdivision
+	// bytes each) and the chords (measures * 4). Then padding up to m_recordSize
+	struct CheckpointPhraseRecord {
+
+		float m_fitnessValue;
+		uint32_t m_phraseID;
+		uint32_t m_melodicNotes;
+		uint32_t m_harmonicNotes;
+		uint32_t m_packedNotes;  // CheckpointGridRecord if the grid follows instead
+		uint32_t m_recordSize;   // Including this header and the padding
+	};
+
+	constexpr uint32_t CheckpointGridRecord = 0xFFFFFFFF;
+
+	constexpr uint32_t CheckpointFileVersion = 2;
+	constexpr uint32_t CheckpointByteOrder = 0x01020304;
+
+	// Everything about the run that isn't stored in the phrases themselves
+	struct CheckpointState {
+
+		uint32_t m_measureCount;
+		uint32_t m_subdivision;
+
+		uint32_t m_generation;
+		uint32_t m_nextPhraseID;
+
+		uint32_t m_seed;
+		bool m_seeded;
+
+		// Writes every phrase as a full grid record, see CheckpointHeader
+		bool m_fixedRecords;
+
+		// Policies without an engine leave their slot null
+		std::mt19937* m_engines[engine_Count];
+	};
+
+	// Most bytes one phrase record can take for the given shape, the grid form is never smaller
+	// than the packed one
+	uint32_t getCheckpointRecordSize(uint32_t measureCount, uint32_t subdivision);
+
+	// Writes a record into a buffer of getCheckpointRecordSize bytes and returns how many it used
+	uint32_t packPhraseRecord(const Phrase* phrase, uint32_t measureCount, uint32_t subdivision, char* record);
+
+	// False if the record's header doesn't fit the shape or runs past the available bytes
+	bool checkPhraseRecord(const char* record, uint64_t available, uint32_t measureCount, uint32_t subdivision);
+
+	// Unpacking needs the phrase's arrays allocated for the same shape already
+	void unpackPhraseRecord(const char* record, uint32_t measureCount, uint32_t subdivision, Phrase* phrase);
+
+	bool writeCheckpoint(const std::string& filepath, const std::vector<Phrase*>& population, const CheckpointState& state);
+
+	// Maps a checkpoint and hands out its contents in place. Opening validates the header, and for
+	// packed files the size of every record, phrases are copied out one at a time as they're restored
+	class CheckpointReader {
+
+	public:
+		CheckpointReader();
+
+		bool open(const std::string& filepath);
+
+		__inline const CheckpointHeader& getHeader() const { return *reinterpret_cast<const CheckpointHeader*>(m_file.data()); }
+		__inline uint32_t getPhraseCount() const { return getHeader().m_phraseCount; }
+
+		// The phrase must already have arrays allocated for the checkpoint's shape
+		void restorePhrase(uint32_t index, Phrase* phrase) const;
+
+		// False if the slot wasn't saved or the state came from an incompatible standard library,
+		// the engine is left untouched in that case
+		bool restoreEngine(CheckpointEngine engine, std::mt19937& randomEngine) const;
+
+	private:
+		__inline const uint64_t* getRecordOffsets() const { return reinterpret_cast<const uint64_t*>(m_file.data() + getHeader().m_indexOffset); }
+
+		// Fixed record files don't need the index, the record's place follows from its number
+		uint64_t getRecordOffset(uint32_t index) const;
+
+		MappedFile m_file;
+	};
+
+} // namespace Genetics
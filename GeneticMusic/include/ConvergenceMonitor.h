@@ -0,0 +1,94 @@
+// Morgen Hyde
+#pragma once
+
+#include <vector>
+#include <cstdint>
+
+#include "Phrase.h"
+
+namespace Genetics {
+
+	enum ConvergenceReason {
+
+		conv_None = 0,
+		conv_FitnessPlateau,      // best and mean fitness stopped improving
+		conv_DiversityCollapse,   // population genomes are nearly identical to the best one
+		conv_DuplicateSaturation, // too many members are exact copies of each other
+		conv_Count
+	};
+
+	const char* getConvergenceReasonName(ConvergenceReason reason);
+
+	struct ConvergenceCriteria {
+
+		bool m_enabled;
+
+		// Never stop before this many generations have been observed
+		uint32_t m_minGenerations;
+
+		// Plateau: stop once neither best nor mean fitness improved by more than the tolerance for N generations
+		uint32_t m_plateauGenerations;
+		float m_plateauTolerance;
+
+		// Diversity: mean fraction of grid slots that differ from the best phrase, 0 means a clone population
+		float m_minDiversity;
+
+		// Duplicates: 1 - (distinct genomes / population size)
+		float m_maxDuplicateRatio;
+	};
+
+	struct ConvergenceStats {
+
+		uint32_t m_generation;
+
+		float m_bestFitness;
+		float m_meanFitness;
+		float m_diversity;
+		float m_duplicateRatio;
+		uint32_t m_uniqueGenomes;
+
+		uint32_t m_stalledGenerations;
+	};
+
+	// Watches the population once per generation and reports when the run has stopped paying off
+	class ConvergenceMonitor {
+
+	public:
+		ConvergenceMonitor();
+		~ConvergenceMonitor();
+
+		// Starts tracking from scratch, call whenever the population is regenerated
+		void reset();
+
+		// Observe a generation, returns the criterion that fired or conv_None to keep going
+		ConvergenceReason update(const std::vector<Phrase*>& population);
+
+		void setCriteria(const ConvergenceCriteria& criteria);
+		__inline const ConvergenceCriteria& getCriteria() const { return m_criteria; }
+
+		__inline const ConvergenceStats& getLatestStats() const { return m_latest; }
+
+	private:
+		float measureDiversity(const std::vector<Phrase*>& population, const Phrase* best);
+		float measureDuplicateRatio(const std::vector<Phrase*>& population);
+
+		// Phrase melody flattened so that only note starts carry data, slots inside notes are -1
+		void flattenMelody(const Phrase* phrase, std::vector<int16_t>& output) const;
+
+		ConvergenceCriteria m_criteria;
+		ConvergenceStats m_latest;
+
+		float m_bestReference;
+		float m_meanReference;
+		bool m_hasReference;
+
+		// Reused between updates so monitoring doesn't allocate every generation
+		std::vector<int16_t> m_bestMelody;
+		std::vector<int16_t> m_memberMelody;
+		std::vector<uint64_t> m_genomeHashes;
+
+		// Packed population members are decoded into this one at a time
+		Phrase m_gridScratch;
+	};
+
+} // namespace Genetics
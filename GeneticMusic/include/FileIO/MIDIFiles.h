@@ -1,53 +1,88 @@
-// Morgen Hyde
-#pragma once
-
-#include <string>
-#include <unordered_map>
-#include <queue>
-
-namespace Genetics {
-
-	struct Phrase;
-	struct MIDIEvent;
-
-	class MIDIHandler {
-
-	public:
-
-		MIDIHandler();
-		~MIDIHandler();
-
-		void setRootDirectory(const std::string& rootDir);
-
-		void writeToMIDI(Phrase* outputPhrase, const std::string& filename);
-		void readFromMIDI(Phrase* inputPhrase, const std::string& filename);
-
-	private:
-
-		unsigned int ticksPerQuarterToArrayIndex(unsigned int ticks, unsigned int division);
-		unsigned int ticksPerSecondToTicksPerQuarter(unsigned int ticks);
-
-		unsigned int arrayIndexToTicksPerQuarter(unsigned int arrayIndex, unsigned int division);
-
-		void dumpQueueToPhrase(Phrase*);
-		void dumpPhraseToQueue(Phrase*);
-
-		struct StatusHandler {
-
-			void(*readFunction)(std::ifstream&, MIDIEvent&, const unsigned char&);
-			void(*writeFunction)(std::ofstream&, const MIDIEvent&, const unsigned char&);
-
-			unsigned char m_statusByte; // 0x8_, 0x9_, 0xA_, etc.
-		};
-
-		struct MIDIComparison {
-			bool operator()(const MIDIEvent&, const MIDIEvent&) const;
-		};
-
-		std::vector<MIDIEvent> m_eventQueue;
-		std::unordered_map<unsigned char, StatusHandler> m_statusHandler;
-		
-		std::string m_rootDirectory;
-	};
-
-} // namespace Genetics
+// Morgen Hyde
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace Genetics {
+
+	struct Phrase;
+	struct MIDIEvent;
+	struct MIDIReadCursor;
+
+	class MIDIHandler {
+
+	public:
+
+		MIDIHandler();
+		~MIDIHandler();
+
+		void setRootDirectory(const std::string& rootDir);
+
+		void writeToMIDI(Phrase* outputPhrase, const std::string& filename);
+		void readFromMIDI(Phrase* inputPhrase, const std::string& filename);
+
+		// Reads the whole track rather than a phrase's worth, into arrays sized to the last event
+		// rounded up to a measure. Same slot grid as readFromMIDI, MIDIMeasureSlots to a 4/4 measure.
+		// Returns false if the file can't be read, a handler reads one file at a time. Nothing is
+		// printed, getLastError says what was wrong with the file
+		bool readMelodyFromMIDI(const std::string& filename, std::vector<char>& pitches, std::vector<char>& rhythm);
+
+		// Why the last read failed, empty if it succeeded
+		__inline const std::string& getLastError() const { return m_lastError; }
+
+		// Size of the last file opened for reading, whether or not it parsed
+		__inline size_t getLastFileSize() const { return m_lastFileSize; }
+
+		// Files are put on a 16th note grid whatever phrase they're going into
+		static constexpr unsigned int MIDIMeasureSlots = 16;
+
+		// Longest melody readMelodyFromMIDI will size arrays for, a corrupt delta time could otherwise
+		// ask for gigabytes
+		static constexpr unsigned int MIDIMaxMeasures = 4096;
+
+	private:
+
+		unsigned int ticksPerQuarterToArrayIndex(unsigned int ticks, unsigned int division);
+		unsigned int ticksPerSecondToTicksPerQuarter(unsigned int ticks);
+
+		unsigned int arrayIndexToTicksPerQuarter(unsigned int arrayIndex, unsigned int division);
+
+		// Reads the file into m_fileBuffer and parses the header and first track into m_eventQueue
+		// straight out of it. Returns false with m_lastError set if the file isn't usable
+		bool readEvents(const std::string& filename);
+
+		void dumpQueueToPhrase(Phrase*);
+
+		// Writes the queued notes into the arrays and fills the gaps with rests no longer than maxRest.
+		// Adds every note and rest written to noteCount, returns false if the notes ran past maxNotes
+		bool dumpQueueToArrays(char* pitches, char* rhythm, unsigned int maxNotes, unsigned int maxRest, unsigned int& noteCount);
+		void dumpPhraseToQueue(Phrase*);
+
+		struct StatusHandler {
+
+			void(*readFunction)(MIDIReadCursor&, MIDIEvent&, const unsigned char&);
+			void(*writeFunction)(std::ofstream&, const MIDIEvent&, const unsigned char&);
+
+			unsigned char m_statusByte; // 0x8_, 0x9_, 0xA_, etc.
+		};
+
+		struct MIDIComparison {
+			bool operator()(const MIDIEvent&, const MIDIEvent&) const;
+		};
+
+		// One handler for each status from 0x8_ to 0xF_, indexed by the high nibble less 8
+		static constexpr unsigned int StatusHandlerCount = 8;
+		__inline const StatusHandler& getStatusHandler(unsigned char status) const { return m_statusHandler[(status >> 4) & 0x07]; }
+
+		std::vector<MIDIEvent> m_eventQueue;
+		std::vector<unsigned char> m_fileBuffer;
+		StatusHandler m_statusHandler[StatusHandlerCount];
+		
+		std::string m_rootDirectory;
+		std::string m_lastError;
+		size_t m_lastFileSize;
+	};
+
+} // namespace Genetics
@@ -1,22 +1,22 @@
-// Morgen Hyde
-#pragma once
-
-namespace Genetics {
-
-	class WAVHandler {
-
-	public:
-
-		WAVHandler();
-		~WAVHandler();
-
-
-
-	private:
-
-
-
-	};
-
-
+// Morgen Hyde
+#pragma once
+
+namespace Genetics {
+
+	class WAVHandler {
+
+	public:
+
+		WAVHandler();
+		~WAVHandler();
+
+
+
+	private:
+
+
+
+	};
+
+
 } // namespace Genetics
\ No newline at end of file
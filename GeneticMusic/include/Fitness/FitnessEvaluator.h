@@ -1,66 +1,113 @@
-#pragma once
-
-#include "PhrasePool.h"
-
-#include <iostream>
-
-namespace Genetics {
-
-	struct Phrase;
-	class PhrasePool;
-	class ExtractorBase;
-
-	// Policy classes for how fitness should occur
-	struct ManualFitness {
-
-	protected:
-		ManualFitness() = default;
-		virtual ~ManualFitness() = default;
-
-		void evaluate(Phrase* phrase);
-	};
-
-	struct AutomaticFitness {
-
-	protected:
-		AutomaticFitness();
-		virtual ~AutomaticFitness();
-
-		void evaluate(Phrase* phrase);
-
-	private:
-		std::vector<ExtractorBase*> m_extractorList;
-	};
-
-	// Policy host, main object interacted with during algorithm operation
-	template <class FitnessPolicy = ManualFitness>
-	class FitnessEvaluator : public FitnessPolicy {
-
-	public:
-		FitnessEvaluator() = default;
-		~FitnessEvaluator() = default;
-
-		void Assess(PhrasePool* phrasePopulation);
-		void Assess(Phrase* phrase);
-	};
-
-	template <class FitnessPolicy>
-	void FitnessEvaluator<FitnessPolicy>::Assess(PhrasePool* phrasePopulation) {
-
-		const std::vector<Phrase*>& population = phrasePopulation->GetPhrases();
-		int phraseLen = phrasePopulation->GetMeasuresPerPhrase();
-		int subDiv = phrasePopulation->GetSmallestSubDivision();
-
-		for (Phrase* iter : population) {
-			FitnessPolicy::evaluate(iter);
-		}
-	}
-
-	template <class FitnessPolicy>
-	void FitnessEvaluator<FitnessPolicy>::Assess(Phrase* phrase) {
-
-		FitnessPolicy::evaluate(phrase);
-	}
-
-
+#pragma once
+
+#include "PhrasePool.h"
+#include "Utility/TaskScheduler.h"
+#include "Utility/Profiler.h"
+
+#include <iostream>
+
+namespace Genetics {
+
+	struct Phrase;
+	class PhrasePool;
+	class ExtractorBase;
+
+	// Policy classes for how fitness should occur
+	struct ManualFitness {
+
+		// Needs a human at the console for every phrase, never evaluate in parallel. Ratings are
+		// averaged with the last one so scoring a phrase again isn't redundant
+		static constexpr bool ParallelEvaluation = false;
+		static constexpr bool CachedEvaluation = false;
+
+	protected:
+		ManualFitness() = default;
+		virtual ~ManualFitness() = default;
+
+		void evaluate(Phrase* phrase);
+	};
+
+	struct AutomaticFitness {
+
+		// Extractors only read shared rule data and use per-thread scratch space. The score only
+		// depends on the notes, so a phrase whose notes haven't changed keeps it
+		static constexpr bool ParallelEvaluation = true;
+		static constexpr bool CachedEvaluation = true;
+
+	protected:
+		AutomaticFitness();
+		virtual ~AutomaticFitness();
+
+		void evaluate(Phrase* phrase);
+
+	private:
+		std::vector<ExtractorBase*> m_extractorList;
+	};
+
+	// Number of phrases handed to a worker at once when assessing a whole population
+	constexpr uint32_t AssessGrainSize = 8;
+
+	// Policy host, main object interacted with during algorithm operation
+	template <class FitnessPolicy = ManualFitness>
+	class FitnessEvaluator : public FitnessPolicy {
+
+	public:
+		FitnessEvaluator() = default;
+		~FitnessEvaluator() = default;
+
+		// Rescores everyone, for when the rules may have changed since the population was scored
+		void Assess(PhrasePool* phrasePopulation);
+
+		// Skips phrases already scored for their current notes (see Phrase::getGenomeKey)
+		void Assess(Phrase* phrase);
+
+	private:
+		void score(Phrase* phrase);
+	};
+
+	template <class FitnessPolicy>
+	void FitnessEvaluator<FitnessPolicy>::Assess(PhrasePool* phrasePopulation) {
+
+		GA_PROFILE_SCOPE("AssessPopulation");
+
+		const std::vector<Phrase*>& population = phrasePopulation->GetPhrases();
+		uint32_t populationSize = static_cast<uint32_t>(population.size());
+
+		if (!FitnessPolicy::ParallelEvaluation) {
+
+			for (Phrase* iter : population) {
+				score(iter);
+			}
+			return;
+		}
+
+		// Each phrase is scored independently so the population splits cleanly across the workers
+		TaskScheduler::getScheduler().parallelFor(0, populationSize, AssessGrainSize, 
+			[this, &population](uint32_t first, uint32_t last) {
+
+			GA_PROFILE_SCOPE("AssessChunk");
+			for (uint32_t i = first; i < last; ++i) {
+				score(population[i]);
+			}
+		});
+	}
+
+	template <class FitnessPolicy>
+	void FitnessEvaluator<FitnessPolicy>::Assess(Phrase* phrase) {
+
+		if (FitnessPolicy::CachedEvaluation && phrase->_fitnessKey != 0 && phrase->_fitnessKey == phrase->getGenomeKey()) {
+			return;
+		}
+
+		score(phrase);
+	}
+
+	template <class FitnessPolicy>
+	void FitnessEvaluator<FitnessPolicy>::score(Phrase* phrase) {
+
+		FitnessPolicy::evaluate(phrase);
+		phrase->_fitnessKey = phrase->getGenomeKey();
+	}
+
+
 } // namespace Genetics
\ No newline at end of file
@@ -1,17 +1,17 @@
-// Morgen Hyde
-#pragma once
-
-namespace Genetics {
-
-	class ModifierBase {
-
-	public:
-		ModifierBase();
-		virtual ~ModifierBase() = default;
-
-	private:
-
-	};
-
-
+// Morgen Hyde
+#pragma once
+
+namespace Genetics {
+
+	class ModifierBase {
+
+	public:
+		ModifierBase();
+		virtual ~ModifierBase() = default;
+
+	private:
+
+	};
+
+
 } // namespace Genetics
\ No newline at end of file
@@ -1,2 +1,2 @@
-// Morgen Hyde
-#pragma once
+// Morgen Hyde
+#pragma once
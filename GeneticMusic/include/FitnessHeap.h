@@ -0,0 +1,48 @@
+// Morgen Hyde
+#pragma once
+
+#include <vector>
+#include <cstdint>
+
+namespace Genetics {
+
+	struct Phrase;
+
+	// Indexed binary min-heap over the slots of a population vector, keyed on fitness.
+	// The worst phrase is always at the top, and since we track where every slot lives in the
+	// heap a replaced slot can be fixed up in O(log N) without searching for it.
+	class FitnessHeap {
+
+	public:
+		FitnessHeap();
+		~FitnessHeap();
+
+		// Rebuild from scratch in O(N), needed whenever the population is reordered
+		void build(const std::vector<Phrase*>& population);
+		void clear();
+
+		// Call after the phrase stored in a slot (or its fitness) has changed
+		void update(uint32_t slot, float fitness);
+
+		__inline uint32_t worstSlot() const { return m_nodes.front().m_slot; }
+		__inline float worstFitness() const { return m_nodes.front().m_fitness; }
+
+		__inline uint32_t size() const { return static_cast<uint32_t>(m_nodes.size()); }
+		__inline bool empty() const { return m_nodes.empty(); }
+
+	private:
+		struct HeapNode {
+
+			float m_fitness;
+			uint32_t m_slot;
+		};
+
+		void siftUp(uint32_t heapIndex);
+		void siftDown(uint32_t heapIndex);
+		void swapNodes(uint32_t lhs, uint32_t rhs);
+
+		std::vector<HeapNode> m_nodes;     // heap position -> fitness and population slot
+		std::vector<uint32_t> m_positions; // population slot -> heap position
+	};
+
+} // namespace Genetics
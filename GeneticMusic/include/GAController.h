@@ -1,85 +1,219 @@
-#pragma once
-
-#include "Generation/PopulationGenerator.h"
-#include "PolicyDefinitions.h"
-
-#include "AudioPlayback/AudioEngine.h"
-
-#include <vector>
-#include <cstdint>
-
-namespace Genetics {
-
-	class SynthesizerBase;
-
-	struct Phrase;
-	struct MeterInfo;
-
-	class GeneticAlgorithmController {
-
-	public:
-		GeneticAlgorithmController();
-		~GeneticAlgorithmController();
-
-		GeneticAlgorithmController(const GeneticAlgorithmController& rhs) = delete;
-		GeneticAlgorithmController& operator=(const GeneticAlgorithmController& rhs) = delete;
-		
-		// State Management Functions //
-		
-		void initializeAlgorithm();
-		void run();
-		void updateAudioEngine();
-		void shutdownAlgorithm();
-
-		void setMeterInfoStruct(const MeterInfo& meterData);
-		void setPhrasePoolSize(uint32_t populationSize);
-		
-		void clearPhrasePool();
-		void setIterationCount(uint32_t iterations);
-
-		// Phrase Manipulation Functions //
-
-		void setActivePhrase(uint32_t phraseID);
-
-		uint32_t getActivePhraseID() const;
-		Phrase* getActivePhrase() const;
-
-		const std::vector<Phrase*>& getPhraseList() const;
-
-		void exportPhraseToMIDI(const std::string& filepath, Phrase* phrase = nullptr) const;
-		void importMIDIToPhrase(const std::string& filepath, Phrase* phrase = nullptr);
-		
-		// Audio Playback Functions //
-
-		void playCurrentlySelectedPhrase();
-		void pauseCurrentlySelectedPhrase();
-		void stopCurrentlySelectedPhrase();
-
-		void setPlaybackSynthesizer(SynthesizerBase* synth);
-
-	private:
-
-		// Phrase and population
-		PopulationGenerator m_populationGen;
-		PhrasePool* m_phrasePool;
-		Phrase* m_activePhrase;
-
-		int16_t m_iterationsPerStep;
-		uint32_t m_totalGenerations;
-		uint32_t m_populationSize;
-
-		// Audio playback
-		SynthesizerBase* m_activeSynth;
-		AudioEngine m_audioEngine;
-
-		// Algorithm steps
-		
-		SelectionType m_selection;
-		BreederType m_breeding;
-		Mutator m_mutation;
-		FitnessType m_fitness;
-		
-	};
-
-
+#pragma once
+
+#include "Generation/PopulationGenerator.h"
+#include "Generation/MarkovModel.h"
+#include "PolicyDefinitions.h"
+#include "HallOfFame.h"
+#include "ConvergenceMonitor.h"
+#include "IntegrityMonitor.h"
+#include "Telemetry.h"
+#include "Checkpoint.h"
+
+#include "AudioPlayback/AudioEngine.h"
+
+#include <vector>
+#include <cstdint>
+
+namespace Genetics {
+
+	class SynthesizerBase;
+
+	struct Phrase;
+	struct MeterInfo;
+
+	class GeneticAlgorithmController {
+
+	public:
+		GeneticAlgorithmController();
+		~GeneticAlgorithmController();
+
+		GeneticAlgorithmController(const GeneticAlgorithmController& rhs) = delete;
+		GeneticAlgorithmController& operator=(const GeneticAlgorithmController& rhs) = delete;
+		
+		// State Management Functions //
+		
+		// Audio can be left off for headless runs where there's no device to play back on
+		void initializeAlgorithm(bool enableAudio = true);
+		void run();
+		void updateAudioEngine();
+		void shutdownAlgorithm();
+
+		void setMeterInfoStruct(const MeterInfo& meterData);
+		void setPhrasePoolSize(uint32_t populationSize);
+
+		// Takes effect the next time the phrase pool is cleared, like the population size
+		void setPhraseShape(uint32_t measureCount, uint32_t subdivision);
+
+		// Seeds every random engine in the algorithm so a run can be repeated exactly,
+		// call clearPhrasePool afterwards to regenerate the population from the seed
+		void setSeed(uint32_t seed);
+
+		// Populations are cut from the melodies of the MIDI files in this directory from the next time
+		// the phrase pool is cleared, an empty path goes back to random phrases. Returns false if no
+		// melody could be read, the population stays random then too
+		bool setSeedCorpus(const std::string& directory);
+
+		// Interval and rhythm model of a corpus, learned from the MIDI files in a directory or mapped
+		// in from tables saved earlier. Populations are sampled from it from the next time the phrase
+		// pool is cleared (unless a seed corpus is set), and initializeAlgorithm adds a mutation that
+		// resamples single measures from it
+		bool trainMarkovModel(const std::string& directory);
+		bool loadMarkovModel(const std::string& filepath);
+		bool saveMarkovModel(const std::string& filepath) const;
+		
+		void clearPhrasePool();
+		void setIterationCount(uint32_t iterations);
+
+		// Run for a wall clock budget instead of a generation count, 0 turns it off
+		void setTimeBudget(uint32_t milliseconds);
+
+		void setWorkerCount(uint32_t workerCount);
+		void setWorkerPinning(bool pinWorkers);
+
+		void setSteadyState(bool steadyState);
+
+		// Keeps population members in the packed form between operators, parents get their grids
+		// back just long enough to breed and children are packed once they're scored and archived.
+		// The active phrase always holds a grid. A memory saving only, the operators still run on
+		// grids so each child pays for an unpack and a pack (the Packing stage in the telemetry)
+		void setPackedPopulation(bool packedPopulation);
+		__inline bool getPackedPopulation() const { return m_packedPopulation; }
+
+		// Early termination, run() stops as soon as one of the enabled criteria fires
+		void setConvergenceCriteria(const ConvergenceCriteria& criteria);
+		void setStopOnConvergence(bool stopOnConvergence);
+		void setPlateauGenerations(uint32_t generations);
+
+		__inline ConvergenceReason getStopReason() const { return m_stopReason; }
+		__inline const ConvergenceStats& getConvergenceStats() const { return m_convergence.getLatestStats(); }
+		__inline uint32_t getTotalGenerations() const { return m_totalGenerations; }
+
+		// Sampled validation of new children, counts are kept per operator and reset with the pool
+		void setIntegritySettings(const IntegritySettings& settings);
+		__inline const IntegrityMonitor& getIntegrity() const { return m_integrity; }
+
+		// Per generation statistics, ".csv" exports text and anything else the binary format
+		bool exportTelemetry(const std::string& filepath);
+		__inline const TelemetryRecorder& getTelemetry() const { return m_telemetry; }
+
+		// Binary snapshot of the population, random engines and generation counter. Only call
+		// between runs, children in flight aren't saved
+		bool saveCheckpoint(const std::string& filepath);
+
+		// Checkpoints are packed by default. Fixed records store every phrase as a grid, larger on
+		// disk but opened without reading anything past the header
+		void setFixedCheckpointRecords(bool fixedRecords);
+
+		// Replaces the population with a checkpoint's and carries on from its generation. Saved
+		// fitness values are kept, call setSeed afterwards to fork the run in a new direction
+		bool loadCheckpoint(const std::string& filepath);
+
+		// Phrase Manipulation Functions //
+
+		void setActivePhrase(uint32_t phraseID);
+
+		uint32_t getActivePhraseID() const;
+		Phrase* getActivePhrase() const;
+
+		const std::vector<Phrase*>& getPhraseList() const;
+
+		// Best-ever archive, entries are copies and stay valid across pruning and resets
+		const std::vector<Phrase*>& getHallOfFame() const;
+		void clearHallOfFame();
+		void setHallOfFameSize(uint32_t archiveSize);
+
+		// Caps the heap held by archived notes, least recently used entries are spilled to the
+		// file and paged back in on demand. 0 keeps the whole archive resident
+		bool setHallOfFameMemoryBudget(size_t residentBytes, const std::string& spillPath = DefaultArchiveSpillPath);
+
+		// Hall of fame entry at a getHallOfFame position, with its notes guaranteed to be resident
+		Phrase* loadHallOfFameEntry(uint32_t rank);
+
+		void exportPhraseToMIDI(const std::string& filepath, Phrase* phrase = nullptr) const;
+		void importMIDIToPhrase(const std::string& filepath, Phrase* phrase = nullptr);
+		
+		// Audio Playback Functions //
+
+		void playCurrentlySelectedPhrase();
+		void pauseCurrentlySelectedPhrase();
+		void stopCurrentlySelectedPhrase();
+
+		void setPlaybackSynthesizer(SynthesizerBase* synth);
+
+	private:
+
+		// One select -> breed -> mutate -> assess pass, the new child is left at the back of the child list
+		Phrase* produceChild();
+
+		void runGeneration();
+		void runSteadyState();
+		void runForTimeBudget();
+
+		// Bookkeeping after every full generation, returns true if the run should stop
+		bool finishGeneration();
+		void recordTelemetry();
+
+		// Packs the population when that mode is on and makes the best member the active phrase
+		void settlePopulation();
+
+		// Every engine a checkpoint saves, null for policies that don't have one
+		void getRandomEngines(std::mt19937* (&engines)[engine_Count]);
+
+		// Applies the worker count and pinning, unless another controller shares the scheduler
+		void reconfigureScheduler();
+
+		// Phrase and population
+		MarkovModel m_markovModel;
+		PopulationGenerator m_populationGen;
+		PhrasePool* m_phrasePool;
+		Phrase* m_activePhrase;
+		HallOfFame m_hallOfFame;
+
+		ConvergenceMonitor m_convergence;
+		ConvergenceReason m_stopReason;
+
+		IntegrityMonitor m_integrity;
+
+		// Time budget, the per child cost estimate carries across runs so the first batch is sized well
+		uint32_t m_timeBudgetMs;
+		double m_childCostEstimate;
+
+		// Telemetry, stage times and child counts accumulate until the generation is recorded
+		TelemetryRecorder m_telemetry;
+		double m_stageTimes[stage_Count];
+		uint32_t m_childrenThisGeneration;
+		std::chrono::steady_clock::time_point m_generationStart;
+
+		// Fixed seed for reproducible runs, only used once setSeed has been called
+		uint32_t m_seed;
+		bool m_seeded;
+
+		uint32_t m_iterationsPerStep;
+		uint32_t m_totalGenerations;
+		uint32_t m_populationSize;
+		bool m_steadyState;
+		bool m_packedPopulation;
+		bool m_fixedCheckpointRecords;
+
+		// Threading, every controller holds a share of the scheduler from construction until
+		// shutdownAlgorithm or destruction, whichever comes first
+		uint32_t m_workerCount;
+		bool m_pinWorkers;
+		bool m_holdsScheduler;
+
+		// Audio playback
+		bool m_audioEnabled;
+		SynthesizerBase* m_activeSynth;
+		AudioEngine m_audioEngine;
+
+		// Algorithm steps
+		
+		SelectionType m_selection;
+		BreederType m_breeding;
+		Mutator m_mutation;
+		FitnessType m_fitness;
+		
+	};
+
+
 } // namespace Genetics
\ No newline at end of file
@@ -1,27 +1,81 @@
-#pragma once
-
-#include <cstdint>
-
-#include "AudioPlayback/AudioDefinitions.h"
-
-namespace Genetics {
-
-	struct PhraseConfig {
-
-		int numMeasures;
-		int smallestSubdivision;
-	};
-
-	constexpr uint16_t DefaultPopulationSize = 24;
-	constexpr uint16_t DefaultMeasureCount = 4;
-	constexpr uint16_t DefaultSubdivision = 16;
-
-	constexpr uint16_t DefaultGenCount = 10;
-
-	constexpr MeterInfo DefaultMeter = { 80, 4, 4 };
-
-	constexpr uint8_t MaxPitch = 108;
-	constexpr uint8_t MinPitch = 21;
-
-
+#pragma once
+
+#include <cstdint>
+
+#include "AudioPlayback/AudioDefinitions.h"
+#include "ConvergenceMonitor.h"
+#include "IntegrityMonitor.h"
+
+namespace Genetics {
+
+	struct PhraseConfig {
+
+		int numMeasures;
+		int smallestSubdivision;
+	};
+
+	constexpr uint16_t DefaultPopulationSize = 24;
+	constexpr uint16_t DefaultMeasureCount = 4;
+	constexpr uint16_t DefaultSubdivision = 16;
+
+	constexpr uint16_t DefaultGenCount = 10;
+
+	// Steady state replaces one member per child instead of merging whole generations
+	constexpr bool DefaultSteadyState = false;
+	constexpr uint16_t ReverseTournamentSize = 3;
+
+	// Population members sit packed between operators, only the parents and child in use hold grids
+	constexpr bool DefaultPackedPopulation = false;
+
+	// Checkpoint phrases as full grids so a file maps without parsing, at several times the size
+	constexpr bool DefaultFixedCheckpointRecords = false;
+
+	// Number of best-ever phrases kept in the hall of fame
+	constexpr uint16_t DefaultHallOfFameSize = 16;
+
+	// Heap the hall of fame's notes may hold before entries spill to disk, 0 keeps them all resident
+	constexpr uint32_t DefaultArchiveBudgetBytes = 0;
+	constexpr const char* DefaultArchiveSpillPath = "Output//HallOfFame.spill";
+
+	// Worker threads for the task scheduler, 0 uses one less than the hardware thread count
+	constexpr uint16_t DefaultWorkerCount = 0;
+	constexpr bool DefaultPinWorkers = false;
+
+	// Time budgeted runs, 0 ms means run the generation count instead
+	constexpr uint32_t DefaultTimeBudgetMs = 0;
+	constexpr uint32_t MaxBudgetBatchSize = 8;
+	constexpr double ChildCostSmoothing = 0.2;
+
+	// Generations of telemetry kept in memory before the oldest records are overwritten
+	constexpr uint32_t DefaultTelemetryCapacity = 4096;
+
+	// Events each thread can record per profiler capture, later events are dropped
+	constexpr uint32_t ProfilerEventsPerThread = 1 << 16;
+
+	// Logging, the queue size must be a power of two. Each call site may print LogRateLimit
+	// messages per window, the rest are only counted
+	constexpr uint32_t LogQueueCapacity = 1 << 12;
+	constexpr uint32_t LogRateLimit = 20;
+	constexpr uint32_t LogRateWindowMs = 1000;
+	constexpr uint32_t LogSinkIntervalMs = 5;
+
+	// Early termination, off by default so interactive runs always do the full generation count
+	// { enabled, min generations, plateau generations, plateau tolerance, min diversity, max duplicate ratio }
+	constexpr ConvergenceCriteria DefaultConvergenceCriteria = { false, 10, 25, 0.0001f, 0.02f, 0.9f };
+
+	// Sampled validation of new children, { sample interval, quarantine corrupt children }
+	constexpr IntegritySettings DefaultIntegritySettings = { 64, true };
+	constexpr uint32_t MaxQuarantinedPhrases = 32;
+
+	constexpr MeterInfo DefaultMeter = { 80, 4, 4 };
+
+	constexpr uint8_t MaxPitch = 108;
+	constexpr uint8_t MinPitch = 21;
+
+	// Seeding from a MIDI corpus, every window is transposed by up to CorpusTransposeRange
+	// semitones either way and then has roughly CorpusJitterChance of its notes moved a step or two
+	constexpr int CorpusTransposeRange = 5;
+	constexpr float CorpusJitterChance = 0.1f;
+
+
 } // namespace Genetics
\ No newline at end of file
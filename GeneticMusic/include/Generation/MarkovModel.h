@@ -0,0 +1,147 @@
+// Morgen Hyde
+#pragma once
+
+#include "Generation/RhythmDictionary.h"
+#include "Utility/MappedFile.h"
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace Genetics {
+
+	struct Phrase;
+	class MelodyCorpus;
+
+	// Intervals are modelled up to an octave either way, wider leaps count as an octave
+	constexpr int MarkovIntervalRange = 12;
+	constexpr uint32_t MarkovIntervalSymbols = 2 * MarkovIntervalRange + 1;
+	constexpr uint32_t MarkovPitchSymbols = 128;
+
+	constexpr uint32_t MarkovFileVersion = 1;
+	constexpr uint32_t MarkovByteOrder = 0x01020304;
+
+	// Every table the model samples from. Rhythm works a measure at a time over RhythmDictionary
+	// pattern IDs, pitch a note at a time over intervals, each backing off to the next shorter
+	// context when the longer one was never seen in the corpus
+	enum MarkovTableID {
+
+		markov_Pitch = 0,    // any note's pitch, for the first note of a phrase
+		markov_Interval0,    // interval with no context
+		markov_Interval1,    // interval after the last interval
+		markov_Interval2,    // interval after the last two, context is older * MarkovIntervalSymbols + newer
+		markov_RhythmStart,  // first measure's pattern
+		markov_Rhythm0,      // pattern with no context
+		markov_Rhythm1,      // pattern after the last measure's
+		markov_TableCount
+	};
+
+	// Binary layout, every offset is from the start of the file and 4 byte aligned:
+	//   MarkovFileHeader
+	//   for each table at its offset: MarkovTableHeader, m_contextCount + 1 uint32_t row starts,
+	//   then m_entryCount MarkovEntry
+	// Nothing needs unpacking, a model is used straight out of the mapped file
+	struct MarkovFileHeader {
+
+		char m_magic[4];        // "GMMK"
+		uint32_t m_version;
+		uint32_t m_byteOrder;   // MarkovByteOrder as written
+		uint32_t m_headerSize;  // sizeof(MarkovFileHeader) when written
+
+		// Rhythm symbols are IDs in the dictionary for this measure length
+		uint32_t m_measureLength;
+		uint32_t m_patternCount;
+
+		uint32_t m_fileSize;
+		uint32_t m_tableOffsets[markov_TableCount];
+	};
+
+	struct MarkovTableHeader {
+
+		uint32_t m_contextCount;
+		uint32_t m_entryCount;
+	};
+
+	// Rows are alias tables (Walker's method): pick an entry uniformly, keep its symbol if the
+	// remainder of the roll is under the threshold and take its alias's symbol otherwise, so a draw
+	// costs the same however many symbols the row has
+	struct MarkovEntry {
+
+		uint16_t m_symbol;
+		uint16_t m_alias;    // index of another entry in the same row
+		float m_threshold;
+	};
+
+	// N-gram model of the melodies in a corpus, for generating phrases that sound like it rather
+	// than copying it. Trained tables can be saved and mapped back in later without retraining
+	class MarkovModel {
+
+	public:
+		MarkovModel();
+		~MarkovModel();
+
+		MarkovModel(const MarkovModel& rhs) = delete;
+		MarkovModel& operator=(const MarkovModel& rhs) = delete;
+
+		// Counts the transitions in every melody of the corpus, replacing any model already loaded.
+		// Returns false if the corpus had nothing to learn from
+		bool train(const MelodyCorpus& corpus);
+
+		bool save(const std::string& filepath) const;
+		bool load(const std::string& filepath);
+		void clear();
+
+		__inline bool isReady() const { return m_header != nullptr; }
+		__inline uint32_t getMeasureLength() const { return m_header ? m_header->m_measureLength : 0; }
+
+		// Phrases with a subdivision other than the measure length trained on can't be sampled
+		bool supports(const Phrase* phrase) const;
+
+		// Fills the phrase's melody, a measure's pattern and then its pitches at a time
+		bool generatePhrase(Phrase* phrase, std::mt19937& engine) const;
+
+		// Draws a new rhythm and pitches for one measure, following on from the notes before it.
+		// Fails without touching the phrase if a note is held across either bar line
+		bool resampleMeasure(Phrase* phrase, uint32_t measure, std::mt19937& engine) const;
+
+	private:
+		struct MarkovTable {
+
+			const uint32_t* m_rowStarts;
+			const MarkovEntry* m_entries;
+			uint32_t m_contextCount;
+		};
+
+		// Where the melody has got to, intervals are held as symbols with the newest last
+		struct MelodyState {
+
+			int m_pitch;
+			uint32_t m_intervals[2];
+			uint32_t m_intervalCount;
+		};
+
+		// Points the tables into the file image, false if the image doesn't hold together
+		bool attach(const char* image, size_t size, const std::string& source);
+
+		static bool drawSymbol(const MarkovTable& table, uint32_t context, std::mt19937& engine, uint16_t& symbol);
+
+		// Start row for the first measure, otherwise the row after the previous pattern (if it's
+		// one the dictionary knows), backing off to the pattern counts
+		uint16_t drawPattern(uint32_t measure, uint16_t previousPattern, std::mt19937& engine) const;
+		char drawPitch(MelodyState& state, std::mt19937& engine) const;
+
+		// Writes the pattern's rhythm into the measure and a pitch on each of its onsets
+		void writeMeasure(Phrase* phrase, uint32_t measure, uint16_t pattern, MelodyState& state, std::mt19937& engine) const;
+
+		RhythmDictionary m_rhythmDictionary;
+
+		// The image is either built by train or mapped in by load
+		std::vector<uint32_t> m_trainedImage;
+		MappedFile m_mappedImage;
+
+		const MarkovFileHeader* m_header;
+		MarkovTable m_tables[markov_TableCount];
+	};
+
+} // namespace Genetics
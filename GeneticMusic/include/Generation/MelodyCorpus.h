@@ -0,0 +1,103 @@
+// Morgen Hyde
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Generation/RhythmDictionary.h"
+
+namespace Genetics {
+
+	struct Phrase;
+
+	struct CorpusImportFailure {
+
+		std::string m_filepath;
+		std::string m_reason;
+	};
+
+	// What an import got through and how quickly, failures are collected here rather than
+	// stopping the import
+	struct CorpusImportStats {
+
+		uint32_t m_filesRequested;
+		uint32_t m_filesImported;
+
+		uint64_t m_bytesRead;    // every file that could be opened, including ones that didn't parse
+		uint64_t m_notesRead;    // sounding notes in the melodies kept, rests aren't counted
+		uint64_t m_measuresRead;
+
+		double m_seconds;        // wall time for the whole import, listing and merging included
+
+		std::vector<CorpusImportFailure> m_failures;
+	};
+
+	// Melodies read out of a directory of MIDI files to seed populations with. Each file is kept
+	// whole on the MIDI reader's 16th grid and only cut into phrase sized windows once the shape
+	// is known, so one corpus serves any number of measures
+	class MelodyCorpus {
+
+	public:
+		MelodyCorpus();
+		~MelodyCorpus();
+
+		// Reads every .mid/.midi file in the directory with importFiles. Replaces whatever was loaded
+		// before, returns how many melodies made it in
+		uint32_t importDirectory(const std::string& directory, CorpusImportStats* stats = nullptr);
+
+		// Reads the files in parallel, each task with its own reader, and adds their melodies after
+		// the ones already loaded in the order given. Files that can't be read or hold no notes are
+		// skipped and listed in the stats with the reason. Windows already built for a shape are
+		// rebuilt to take in the new melodies. Returns how many melodies were added
+		uint32_t importFiles(const std::vector<std::string>& filepaths, CorpusImportStats* stats = nullptr);
+		void clear();
+
+		__inline uint32_t getMelodyCount() const { return static_cast<uint32_t>(m_melodies.size()); }
+
+		// A whole melody on the 16th grid, rests included, padded to a whole number of measures
+		__inline const std::vector<char>& getMelodyPitches(uint32_t melody) const { return m_melodies[melody].m_pitches; }
+		__inline const std::vector<char>& getMelodyRhythm(uint32_t melody) const { return m_melodies[melody].m_rhythm; }
+
+		// Lists the windows phrases of this shape can be cut from: every bar line that isn't in the
+		// middle of a held note, as long as at least half the window is sounding notes. Only the
+		// reader's grid can be cut, any other subdivision gets no windows
+		uint32_t buildWindows(uint32_t measureCount, uint32_t subdivision);
+
+		__inline uint32_t getWindowCount() const { return static_cast<uint32_t>(m_windows.size()); }
+		__inline bool hasWindowsFor(uint32_t measureCount, uint32_t subdivision) const {
+			return measureCount == m_windowMeasures && subdivision == m_windowSubdivision;
+		}
+
+		// Writes a window over the phrase's melody, each measure quantised onto the nearest rhythm
+		// pattern with its rests folded into the notes before them. Returns the number of notes written
+		uint32_t copyWindow(uint32_t window, Phrase* phrase) const;
+
+		// Lowest and highest pitch sounding in the window
+		void getWindowRange(uint32_t window, int& lowest, int& highest) const;
+
+	private:
+		struct CorpusMelody {
+
+			std::vector<char> m_pitches;
+			std::vector<char> m_rhythm;
+		};
+
+		struct CorpusWindow {
+
+			uint32_t m_melody;
+			uint32_t m_start; // slot the window starts on
+		};
+
+		std::vector<CorpusMelody> m_melodies;
+
+		// Windows for the last shape asked for
+		std::vector<CorpusWindow> m_windows;
+		uint32_t m_windowMeasures;
+		uint32_t m_windowSubdivision;
+
+		// Every measure pattern on the reader's grid, windows are quantised onto these
+		RhythmDictionary m_rhythmDictionary;
+	};
+
+} // namespace Genetics
@@ -1,48 +1,100 @@
-#pragma once
-
-#include "PoolAllocator.h"
-#include "GADefaultConfig.h"
-
-#include <random>
-
-namespace Genetics {
-	
-	
-	class PhrasePool;
-	struct Phrase;
-
-	// TODO: Make this a policy host with policies for melodic, harmonic, and rhythmic generation
-	class PopulationGenerator
-	{
-	public:
-		PopulationGenerator(unsigned populationSize, const PhraseConfig& configuration);
-		~PopulationGenerator();
-
-		void resetAllocator(uint32_t newSize = 0);
-
-		unsigned GetPopulationSize() const;
-		PhrasePool* GeneratePopulation();
-	
-	private:
-
-		struct SubdivisionInfo
-		{
-			short length;
-			float layerMod;
-			short subDivMin;
-		};
-
-		void generateMelodic(Phrase* phrase, unsigned numMeasures, unsigned subDiv);
-		void generateHarmonic(Phrase* phrase, unsigned numMeasures, unsigned subDiv);
-
-		void subdivisionPattern(std::vector<char>& pattern, const SubdivisionInfo& info, short layer, float density);
-
-		PhraseConfig m_configuration;
-		unsigned m_populationSize;
-
-		PoolAllocator<Phrase>* m_phraseAllocator;
-		std::mt19937 m_randomEngine;
-	};
-
-
+#pragma once
+
+#include "PoolAllocator.h"
+#include "GADefaultConfig.h"
+#include "Generation/RhythmDictionary.h"
+#include "Generation/MelodyCorpus.h"
+
+#include <random>
+#include <string>
+#include <vector>
+#include <utility>
+
+namespace Genetics {
+	
+	
+	class PhrasePool;
+	class MarkovModel;
+	struct Phrase;
+
+	// TODO: Make this a policy host with policies for melodic, harmonic, and rhythmic generation
+	class PopulationGenerator
+	{
+	public:
+		PopulationGenerator(unsigned populationSize, const PhraseConfig& configuration);
+		~PopulationGenerator();
+
+		void resetAllocator(uint32_t newSize = 0);
+
+		// Master seed, every phrase seed is drawn from it so a seeded generator always builds the same population
+		void Seed(uint32_t seed);
+		__inline std::mt19937* GetRandomEngine() { return &m_randomEngine; }
+
+		// Phrase shape for every population generated from now on
+		void SetConfiguration(const PhraseConfig& configuration);
+		__inline const PhraseConfig& GetConfiguration() const { return m_configuration; }
+
+		unsigned GetPopulationSize() const;
+		PhrasePool* GeneratePopulation();
+
+		// Empty pool over the generator's allocator, for callers that fill in the phrases themselves
+		PhrasePool* AllocatePopulation();
+
+		// Seeds populations from the MIDI files in the directory instead of random notes. Returns the
+		// number of melodies loaded, with none the generator stays random
+		uint32_t LoadCorpus(const std::string& directory, CorpusImportStats* stats = nullptr);
+		void ClearCorpus();
+		__inline uint32_t GetCorpusSize() const { return m_corpus.getMelodyCount(); }
+
+		// Melodies are sampled from the model when one's ready for the shape and no corpus is
+		// loaded, the corpus takes priority as it was asked for more directly
+		__inline void SetMarkovModel(const MarkovModel* model) { m_markovModel = model; }
+	
+	private:
+
+		struct SubdivisionInfo
+		{
+			short length;
+			float layerMod;
+			short subDivMin;
+		};
+
+		// Generation runs on worker threads, each fixed run of phrases is given its own engine so
+		// the output only depends on the master seed and not on how the work was split up
+		void generateMelodic(Phrase* phrase, unsigned numMeasures, unsigned subDiv, std::mt19937& engine);
+
+		// Fallback for subdivisions the rhythm table doesn't cover, recurses for every measure
+		void generateMelodicRecursive(Phrase* phrase, unsigned numMeasures, unsigned subDiv, std::mt19937& engine);
+		void generateHarmonic(Phrase* phrase, unsigned numMeasures, unsigned subDiv);
+
+		// Melody cut from a random corpus window, transposed and lightly jittered
+		void seedFromCorpus(Phrase* phrase, std::mt19937& engine);
+
+		void subdivisionPattern(std::vector<char>& pattern, const SubdivisionInfo& info, short layer, float density, std::mt19937& engine);
+
+		// Odds of subdivisionPattern producing each onset mask for the span at this layer, worked
+		// out from the same densities instead of sampled
+		void subdivisionOdds(std::vector<std::pair<uint16_t, double>>& odds, const SubdivisionInfo& info, short layer, float density) const;
+
+		// Enumerates the measure rhythms for the configured subdivision and how likely each one is
+		void buildRhythmTable();
+
+		// One draw from the table, same distribution as a full subdivisionPattern recursion
+		uint16_t drawRhythmPattern(std::mt19937& engine) const;
+
+		PhraseConfig m_configuration;
+		unsigned m_populationSize;
+
+		PoolAllocator<Phrase>* m_phraseAllocator;
+		std::mt19937 m_randomEngine;
+
+		// Empty when the subdivision can't be enumerated, generation recurses per measure instead
+		RhythmDictionary m_rhythmDictionary;
+		std::vector<double> m_rhythmOdds; // running total over pattern IDs
+
+		MelodyCorpus m_corpus;
+		const MarkovModel* m_markovModel;
+	};
+
+
 } // namepsace Genetics
\ No newline at end of file
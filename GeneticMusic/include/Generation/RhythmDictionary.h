@@ -0,0 +1,64 @@
+// Morgen Hyde
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace Genetics {
+
+	constexpr uint16_t InvalidRhythmPattern = 0xFFFF;
+
+	// Every rhythm a measure can have when it's built by halving notes, the way the population
+	// generator and the Subdivide/Merge mutations build them. There are only a handful (677 for a
+	// 16 slot measure down to single slots) so they're all enumerated up front and given IDs. A
+	// pattern is fully described by which slots start a note, IDs are handed out in order of that
+	// mask so looking one up is a binary search
+	class RhythmDictionary {
+
+	public:
+		// Longest measure enumerated, the next power of two up has over 450000 patterns
+		static constexpr uint32_t MaxMeasureLength = 16;
+
+		RhythmDictionary();
+		~RhythmDictionary();
+
+		// Measure lengths that can be enumerated: powers of two up to MaxMeasureLength
+		static bool supports(uint32_t measureLength);
+
+		// Enumerates every pattern for a measure of measureLength slots with no note shorter than
+		// minLength. Returns false and leaves the dictionary empty for unsupported lengths
+		bool build(uint32_t measureLength, uint32_t minLength);
+
+		__inline uint32_t size() const { return static_cast<uint32_t>(m_onsetMasks.size()); }
+		__inline uint32_t getMeasureLength() const { return m_measureLength; }
+
+		// Pattern in slot grid form, measureLength entries holding the note length at each onset
+		__inline const char* getRhythm(uint16_t pattern) const { return m_rhythms.data() + pattern * m_measureLength; }
+
+		// Bit i set if a note starts on slot i
+		__inline uint16_t getOnsetMask(uint16_t pattern) const { return m_onsetMasks[pattern]; }
+
+		__inline uint32_t getNoteCount(uint16_t pattern) const { return m_noteCounts[pattern]; }
+
+		// ID of the pattern with these onsets, InvalidRhythmPattern if no pattern has them
+		uint16_t findPattern(uint16_t onsetMask) const;
+
+		// ID of the pattern a measure's slot grid holds, InvalidRhythmPattern if the measure isn't
+		// one (a note tied over the bar line, a length that isn't a power of two, ...)
+		uint16_t findPattern(const char* measureRhythm) const;
+
+		// Pattern whose onsets differ from the mask in the fewest slots, ties going to the lower ID.
+		// For measures from outside the algorithm (MIDI files) that aren't a pattern themselves
+		uint16_t findNearestPattern(uint16_t onsetMask) const;
+
+	private:
+		void enumerate(uint32_t length, uint32_t minLength, std::vector<uint16_t>& masks) const;
+
+		std::vector<uint16_t> m_onsetMasks;
+		std::vector<uint8_t> m_noteCounts;
+		std::vector<char> m_rhythms;
+
+		uint32_t m_measureLength;
+	};
+
+} // namespace Genetics
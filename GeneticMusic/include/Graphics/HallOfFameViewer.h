@@ -0,0 +1,24 @@
+// Morgen Hyde
+#pragma once
+
+#include "UIElements.h"
+#include <memory>
+
+namespace Genetics {
+
+	struct HallOfFameInterface;
+
+	class HallOfFameViewer : public UIElement {
+
+	public:
+		HallOfFameViewer(std::unique_ptr<HallOfFameInterface> interface);
+		~HallOfFameViewer();
+
+		void render() override;
+
+	private:
+		std::unique_ptr<HallOfFameInterface> m_interface;
+
+	};
+
+} // namespace Genetics
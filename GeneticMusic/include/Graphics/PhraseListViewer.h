@@ -1,24 +1,24 @@
-// Morgen Hyde
-#pragma once
-
-#include "UIElements.h"
-#include <memory>
-
-namespace Genetics {
-
-	struct PhraseSelectorInterface;
-
-	class PhraseListViewer : public UIElement {
-
-	public:
-		PhraseListViewer(std::unique_ptr<PhraseSelectorInterface> interface);
-		~PhraseListViewer();
-
-		void render() override;
-
-	private:
-		std::unique_ptr<PhraseSelectorInterface> m_interface;
-
-	};
-
+// Morgen Hyde
+#pragma once
+
+#include "UIElements.h"
+#include <memory>
+
+namespace Genetics {
+
+	struct PhraseSelectorInterface;
+
+	class PhraseListViewer : public UIElement {
+
+	public:
+		PhraseListViewer(std::unique_ptr<PhraseSelectorInterface> interface);
+		~PhraseListViewer();
+
+		void render() override;
+
+	private:
+		std::unique_ptr<PhraseSelectorInterface> m_interface;
+
+	};
+
 } // namespace Genetics
\ No newline at end of file
@@ -1,16 +1,16 @@
-#pragma once
-
-namespace Genetics {
-
-	class UIElement {
-
-	public:
-
-		UIElement() {}
-		virtual ~UIElement() {}
-
-		virtual void render() = 0;
-	};
-
-
+#pragma once
+
+namespace Genetics {
+
+	class UIElement {
+
+	public:
+
+		UIElement() {}
+		virtual ~UIElement() {}
+
+		virtual void render() = 0;
+	};
+
+
 } // namespace Genetics
\ No newline at end of file
@@ -0,0 +1,99 @@
+// Morgen Hyde
+#pragma once
+
+#include "PhraseSpillFile.h"
+
+#include <vector>
+#include <list>
+#include <string>
+#include <unordered_set>
+#include <unordered_map>
+#include <cstdint>
+
+namespace Genetics {
+
+	struct Phrase;
+
+	// Bounded archive of the best phrases ever assessed. Entries are deep copies so they survive
+	// pruning and resets, the archive is a min-heap on fitness so the weakest entry is always the
+	// one considered for eviction, and genome hashes keep the same melody from filling every slot
+	class HallOfFame {
+
+	public:
+		HallOfFame(uint32_t capacity);
+		~HallOfFame();
+
+		HallOfFame(const HallOfFame& rhs) = delete;
+		HallOfFame& operator=(const HallOfFame& rhs) = delete;
+
+		// Copies the phrase in if it beats the weakest entry and isn't already archived, O(log K)
+		bool offer(const Phrase* phrase);
+		void offerAll(const std::vector<Phrase*>& phrases);
+
+		void clear();
+		void setCapacity(uint32_t capacity);
+
+		// Archived phrases best first, rebuilt lazily so repeated reads from the UI are free. With a
+		// memory budget set, spilled entries only keep their fitness and ID, use loadEntry for the notes
+		const std::vector<Phrase*>& getEntries() const;
+
+		// Caps the heap held by archived notes. Past the budget the least recently used entries are
+		// written to the spill file and their arrays freed, 0 keeps everything resident
+		bool setMemoryBudget(size_t residentBytes, const std::string& spillPath);
+
+		// Entry at a getEntries position with its notes paged back in if they were spilled. The
+		// pointer stays usable until the next call that can spill, like offer or another loadEntry
+		Phrase* loadEntry(uint32_t rank);
+
+		__inline size_t getResidentBytes() const { return m_residentBytes; }
+		__inline uint32_t getSpilledCount() const { return m_memoryBudget ? size() - static_cast<uint32_t>(m_residentOrder.size()) : 0; }
+
+		__inline uint32_t size() const { return static_cast<uint32_t>(m_heap.size()); }
+		__inline uint32_t capacity() const { return m_capacity; }
+
+		// Fitness a phrase needs to beat to get in, lowest float until the archive is full
+		float getAdmissionThreshold() const;
+
+	private:
+		struct ArchiveEntry {
+
+			Phrase* m_phrase;
+			uint64_t m_genomeHash;
+		};
+
+		// Where an entry's notes live while the budget is on
+		struct Residency {
+
+			uint64_t m_spillOffset; // InvalidSpillOffset until it's been written out once
+			bool m_resident;
+			std::list<Phrase*>::iterator m_lruPosition;
+		};
+
+		void evictWeakest();
+
+		// Budget bookkeeping, only used while m_memoryBudget is non zero
+		void trackResident(Phrase* phrase);
+		void forget(Phrase* phrase);
+		bool spill(Phrase* phrase);
+		bool pageIn(Phrase* phrase);
+		void enforceBudget(const Phrase* keep);
+
+		std::vector<ArchiveEntry> m_heap;
+		std::unordered_set<uint64_t> m_genomeHashes;
+
+		mutable std::vector<Phrase*> m_sortedEntries;
+		mutable bool m_sortedDirty;
+
+		uint32_t m_capacity;
+
+		// Resident entries least recently used first, the front is the next to be spilled
+		size_t m_memoryBudget;
+		size_t m_residentBytes;
+		std::list<Phrase*> m_residentOrder;
+		std::unordered_map<const Phrase*, Residency> m_residency;
+
+		std::string m_spillPath;
+		PhraseSpillFile m_spillFile;
+	};
+
+} // namespace Genetics
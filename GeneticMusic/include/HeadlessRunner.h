@@ -0,0 +1,49 @@
+// Morgen Hyde
+#pragma once
+
+#include <string>
+#include <cstdint>
+
+namespace Genetics {
+
+	// Command line options for running the algorithm without the GUI or audio, e.g.
+	//   GeneticMusic.exe --headless --generations 200 --rules Output//MyRules.xml --export Output//Best
+	struct HeadlessOptions {
+
+		HeadlessOptions();
+
+		bool m_headless;
+		bool m_steadyState;
+		bool m_packedPopulation;
+		bool m_fixedCheckpoint;      // Checkpoint with grid records that map without parsing
+		bool m_stopOnConvergence;
+		bool m_useSeed;
+		bool m_quarantine;
+
+		uint32_t m_generations;
+		uint32_t m_hallOfFameSize;
+		uint32_t m_plateauGenerations;
+		uint32_t m_timeBudgetMs;
+		uint32_t m_seed;             // Only used if m_useSeed is set, otherwise every run is different
+		uint32_t m_checkInterval;    // Validate every Nth child, 0 turns integrity checking off
+		uint32_t m_archiveBudgetKB;  // Hall of fame notes past this are spilled to m_spillPath, 0 keeps them in memory
+
+		std::string m_rulesPath;    // Rule set to import before running, defaults are used if empty
+		std::string m_corpusPath;   // Directory of MIDI files to cut the first population from
+		std::string m_modelPath;    // Directory of MIDI files to train a model on, or a saved .gmmk model
+		std::string m_modelSavePath;
+		std::string m_exportPrefix; // Hall of fame entries are written to <prefix>_<rank>.midi if set
+		std::string m_telemetryPath; // Per generation stats, CSV if it ends in .csv otherwise binary
+		std::string m_tracePath;     // Chrome trace of the run, needs a GA_ENABLE_PROFILING build
+		std::string m_resumePath;    // Checkpoint to continue from instead of a fresh population
+		std::string m_checkpointPath; // Population is checkpointed here once the run finishes
+		std::string m_spillPath;
+	};
+
+	// Returns false and prints usage if an argument wasn't understood
+	bool parseCommandLine(int argc, char** argv, HeadlessOptions& options);
+
+	// Runs to completion and prints the hall of fame, returns the process exit code
+	int runHeadless(const HeadlessOptions& options);
+
+} // namespace Genetics
@@ -0,0 +1,83 @@
+// Morgen Hyde
+#pragma once
+
+#include "Utility/Diagnostics.h"
+
+#include <vector>
+#include <cstdint>
+#include <ostream>
+
+namespace Genetics {
+
+	struct Phrase;
+
+	struct IntegritySettings {
+
+		// Validate one child out of every N, 0 turns checking off and 1 checks every child
+		uint32_t m_sampleInterval;
+
+		// Corrupt children are archived and replaced with a copy of their parent before they can
+		// reach the population, otherwise they are only counted
+		bool m_quarantine;
+	};
+
+	// Violations attributed to the operator that produced them
+	struct IntegrityOperatorStats {
+
+		const char* m_name;
+
+		uint64_t m_checked;
+		uint64_t m_violations[enm_errorCount];
+	};
+
+	// Release builds can't afford the _DEBUG validators on every child, this runs the same checks
+	// on a sample of them so corruption from an operator still shows up in long production runs
+	class IntegrityMonitor {
+
+	public:
+		IntegrityMonitor();
+		~IntegrityMonitor();
+
+		IntegrityMonitor(const IntegrityMonitor& rhs) = delete;
+		IntegrityMonitor& operator=(const IntegrityMonitor& rhs) = delete;
+
+		// Operator indices passed to check are positions in this list
+		void setOperators(const std::vector<const char*>& operatorNames);
+
+		void setSettings(const IntegritySettings& settings);
+		__inline const IntegritySettings& getSettings() const { return m_settings; }
+
+		// Advances the sample counter, true if the next child should be validated
+		bool sampleNext();
+
+		// Validates the phrase and charges any violation to the operator, returns false if it's corrupt
+		bool check(Phrase* phrase, uint32_t operatorIndex);
+
+		// Keeps a copy of the corrupt phrase for inspection and overwrites it with the replacement
+		void quarantine(Phrase* phrase, const Phrase* replacement);
+
+		// Clears counts and releases every quarantined copy
+		void reset();
+
+		__inline const std::vector<IntegrityOperatorStats>& getOperatorStats() const { return m_operators; }
+		__inline const std::vector<Phrase*>& getQuarantined() const { return m_quarantined; }
+
+		__inline uint64_t getCheckedCount() const { return m_checked; }
+		__inline uint64_t getViolationCount() const { return m_violations; }
+
+		void printReport(std::ostream& output) const;
+
+	private:
+		void clearQuarantine();
+
+		IntegritySettings m_settings;
+		uint32_t m_sampleCountdown;
+
+		std::vector<IntegrityOperatorStats> m_operators;
+		std::vector<Phrase*> m_quarantined;
+
+		uint64_t m_checked;
+		uint64_t m_violations;
+	};
+
+} // namespace Genetics
@@ -1,115 +1,136 @@
-#pragma once
-
-#include <random>
-
-namespace Genetics {
-
-	struct Phrase;
-	class Mutator;
-
-	typedef void (Mutator::*Mutation)(Phrase*);
-
-	/*
-	struct MutationBase {
-
-		virtual int16_t getWeight() const = 0;
-		virtual void operator()(Phrase* phrase) const = 0;
-	};
-
-	struct NullOperator : public MutationBase {
-
-		int16_t getWeight() const override;
-		void operator()(Phrase* phrase) const override;
-	};
-
-	struct Subdivide : public MutationBase {
-
-		int16_t getWeight() const override;
-		void operator()(Phrase* phrase) const override;
-	};
-
-	struct Merge : public MutationBase {
-
-		int16_t getWeight() const override;
-		void operator()(Phrase* phrase) const override;
-	};
-
-	struct Rest : public MutationBase {
-
-		int16_t getWeight() const override;
-		void operator()(Phrase* phrase) const override;
-	};
-
-	struct Rotate : public MutationBase {
-
-		int16_t getWeight() const override;
-		void operator()(Phrase* phrase) const override;
-	};
-
-	struct Transpose : public MutationBase {
-
-		int16_t getWeight() const override;
-		void operator()(Phrase* phrase) const override;
-	};
-
-	struct SortAscending : public MutationBase {
-
-		int16_t getWeight() const override;
-		void operator()(Phrase* phrase) const override;
-	};
-
-	struct SortDescending : public MutationBase {
-
-		int16_t getWeight() const override;
-		void operator()(Phrase* phrase) const override;
-	};
-
-	struct Inversion : public MutationBase {
-
-		int16_t getWeight() const override;
-		void operator()(Phrase* phrase) const override;
-	};
-
-	struct Retrograde : public MutationBase {
-
-		int16_t getWeight() const override;
-		void operator()(Phrase* phrase) const override;
-	};
-	*/
-
-	class Mutator
-	{
-	public:
-		Mutator();
-		~Mutator();
-
-		void InitMutationPool();
-
-		void Mutate(Phrase* phrase);
-
-	private:
-		void NullOperator(Phrase*);
-
-		// Rhythmically based operations
-		void Subdivide(Phrase*);
-		void Merge(Phrase*);
-		void Rest(Phrase*);
-
-		// Pitch based operations
-		void Rotate(Phrase*);
-		void Transpose(Phrase*);
-		void SortAscending(Phrase*);
-		void SortDescending(Phrase*);
-		void Inversion(Phrase*);
-		void Retrograde(Phrase*);
-
-		std::mt19937 m_randomEngine;
-
-		std::vector<short> m_mutationWeights;
-		std::vector<Mutation> m_mutationPool;
-		//std::vector<MutationBase*> m_mutationPool2;
-
-		unsigned m_numMutations;
-	};
-
+#pragma once
+
+#include <random>
+#include <cstdint>
+
+namespace Genetics {
+
+	struct Phrase;
+	class Mutator;
+	class MarkovModel;
+
+	typedef void (Mutator::*Mutation)(Phrase*);
+
+	/*
+	struct MutationBase {
+
+		virtual int16_t getWeight() const = 0;
+		virtual void operator()(Phrase* phrase) const = 0;
+	};
+
+	struct NullOperator : public MutationBase {
+
+		int16_t getWeight() const override;
+		void operator()(Phrase* phrase) const override;
+	};
+
+	struct Subdivide : public MutationBase {
+
+		int16_t getWeight() const override;
+		void operator()(Phrase* phrase) const override;
+	};
+
+	struct Merge : public MutationBase {
+
+		int16_t getWeight() const override;
+		void operator()(Phrase* phrase) const override;
+	};
+
+	struct Rest : public MutationBase {
+
+		int16_t getWeight() const override;
+		void operator()(Phrase* phrase) const override;
+	};
+
+	struct Rotate : public MutationBase {
+
+		int16_t getWeight() const override;
+		void operator()(Phrase* phrase) const override;
+	};
+
+	struct Transpose : public MutationBase {
+
+		int16_t getWeight() const override;
+		void operator()(Phrase* phrase) const override;
+	};
+
+	struct SortAscending : public MutationBase {
+
+		int16_t getWeight() const override;
+		void operator()(Phrase* phrase) const override;
+	};
+
+	struct SortDescending : public MutationBase {
+
+		int16_t getWeight() const override;
+		void operator()(Phrase* phrase) const override;
+	};
+
+	struct Inversion : public MutationBase {
+
+		int16_t getWeight() const override;
+		void operator()(Phrase* phrase) const override;
+	};
+
+	struct Retrograde : public MutationBase {
+
+		int16_t getWeight() const override;
+		void operator()(Phrase* phrase) const override;
+	};
+	*/
+
+	class Mutator
+	{
+	public:
+		Mutator();
+		~Mutator();
+
+		void InitMutationPool();
+		void Seed(uint32_t seed);
+
+		// Resampling measures from the model joins the pool if it's ready when the pool is built
+		__inline void SetMarkovModel(const MarkovModel* model) { m_markovModel = model; }
+		__inline std::mt19937* GetRandomEngine() { return &m_randomEngine; }
+
+		void Mutate(Phrase* phrase);
+
+		// Direct access to a single mutation, used to time each operator on its own
+		__inline unsigned GetMutationCount() const { return m_numMutations; }
+		__inline const char* GetMutationName(unsigned index) const { return m_mutationNames[index]; }
+		void ApplyMutation(unsigned index, Phrase* phrase);
+
+		// Index of the mutation picked by the most recent call to Mutate
+		__inline unsigned GetLastMutation() const { return m_lastMutation; }
+
+	private:
+		void NullOperator(Phrase*);
+
+		// Rhythmically based operations
+		void Subdivide(Phrase*);
+		void Merge(Phrase*);
+		void Rest(Phrase*);
+
+		// Pitch based operations
+		void Rotate(Phrase*);
+		void Transpose(Phrase*);
+		void SortAscending(Phrase*);
+		void SortDescending(Phrase*);
+		void Inversion(Phrase*);
+		void Retrograde(Phrase*);
+
+		// Model based operations
+		void ResampleMeasure(Phrase*);
+
+		std::mt19937 m_randomEngine;
+		const MarkovModel* m_markovModel;
+
+		std::vector<short> m_mutationWeights;
+		std::vector<Mutation> m_mutationPool;
+		std::vector<const char*> m_mutationNames;
+		//std::vector<MutationBase*> m_mutationPool2;
+
+		unsigned m_numMutations;
+		unsigned m_lastMutation;
+	};
+
 } // namespace Genetics
\ No newline at end of file
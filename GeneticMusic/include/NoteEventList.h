@@ -0,0 +1,43 @@
+// Morgen Hyde
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace Genetics {
+
+	struct Phrase;
+
+	// Dense form of a phrase's melody, one entry per note in the order they're played. The slot grid
+	// is still the genome every operator edits, this is rebuilt from it in one pass whenever
+	// something wants to walk the notes rather than the slots. Each field gets its own array so a
+	// consumer that only cares about pitches or lengths can hand that array over as is
+	class NoteEventList {
+
+	public:
+		NoteEventList();
+		~NoteEventList();
+
+		// Replaces the contents with the notes of the phrase, storage only ever grows
+		void build(const Phrase* phrase);
+
+		__inline uint32_t size() const { return m_noteCount; }
+
+		// Pitch of each note, 0 for a rest
+		__inline const char* pitches() const { return m_pitches.data(); }
+
+		// Length of each note in slots
+		__inline const char* durations() const { return m_durations.data(); }
+
+		// Slot each note starts on
+		__inline const uint16_t* onsets() const { return m_onsets.data(); }
+
+	private:
+		std::vector<char> m_pitches;
+		std::vector<char> m_durations;
+		std::vector<uint16_t> m_onsets;
+
+		uint32_t m_noteCount;
+	};
+
+} // namespace Genetics
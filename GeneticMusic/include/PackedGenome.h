@@ -0,0 +1,48 @@
+// Morgen Hyde
+#pragma once
+
+#include <cstdint>
+
+namespace Genetics {
+
+	struct Phrase;
+
+	// Compact encoding for phrases at rest, and for population members between operators when the
+	// controller runs with a packed population. The slot grid keeps a byte of pitch and a byte of rhythm
+	// for every subdivision, most of them zero. Packed, each note takes 10 bits (7 of pitch, 3 of
+	// log2 length) and each chord takes 5 (3 of numeral, 2 of type), all in one little endian bit
+	// stream. Onsets aren't stored, they fall out of adding up the lengths
+	constexpr uint32_t PackedPitchBits  = 7;
+	constexpr uint32_t PackedLengthBits = 3;
+	constexpr uint32_t PackedNoteBits   = PackedPitchBits + PackedLengthBits;
+	constexpr uint32_t PackedChordBits  = 5;
+
+	// Bytes taken by the packed form of noteCount notes and chordCount chords
+	uint32_t getPackedGenomeSize(uint32_t noteCount, uint32_t chordCount);
+
+	// Packs the melody and the shape's measures * 4 chords into output, which needs room for
+	// getPackedGenomeSize(maxNotes, chordCount) bytes. Returns false without writing anything
+	// complete if the phrase can't be packed without losing something: lengths that aren't powers
+	// of two, pitches outside 0-127, notes that don't exactly tile the phrase or leftover pitches
+	// between notes. Callers keep the grid form for those
+	bool packGenome(const Phrase* phrase, char* output, uint32_t& noteCount);
+
+	// Rebuilds the grid and chords, the phrase needs arrays allocated for its shape already
+	void unpackGenome(const char* input, uint32_t noteCount, Phrase* phrase);
+
+	// Bytes packPhrase needs as scratch for a phrase of this shape
+	uint32_t getPackScratchSize(uint32_t measureCount, uint32_t subdivision);
+
+	// Swaps the phrase's grid for an exactly sized block holding the packed form, using scratch
+	// (getPackScratchSize bytes) to pack into first. Phrases that can't be packed without losing
+	// something keep their grid and false comes back
+	bool packPhrase(Phrase* phrase, char* scratch);
+
+	// Gives a packed phrase its grid back, phrases already holding one are left alone
+	void unpackPhrase(Phrase* phrase);
+
+	// The phrase itself if it holds a grid, otherwise its notes decoded into scratch, which is
+	// (re)allocated for the shape as needed. For readers that only look at the notes
+	const Phrase* getGridView(const Phrase* phrase, Phrase& scratch);
+
+} // namespace Genetics
@@ -1,83 +1,231 @@
-#pragma once
-#include <cstring>
-#include <cstdint>
-
-#include "ChordDefinitions.h"
-
-namespace Genetics {
-
-	struct Phrase {
-
-		Phrase() 
-			: _melodicData(0), _melodicRhythm(0), _melodicNotes(0), _harmonicData(0), 
-			  _harmonicNotes(0), _fitnessValue(0.0f), _phraseID(++_phraseCount) {
-		}
-
-		Phrase(const Phrase& rhs)
-			: _phraseID(++_phraseCount) {
-
-			uint32_t arrayLen = _numMeasures * _smallestSubdivision;
-			
-			_melodicNotes = rhs._melodicNotes;
-			// If the source has melody data, copy it
-			if (rhs._melodicData) {
-				_melodicData   = new char[arrayLen];
-				std::memcpy(_melodicData, rhs._melodicData, arrayLen);
-			}
-			if (rhs._melodicRhythm) {
-				_melodicRhythm = new char[arrayLen];
-				std::memcpy(_melodicRhythm, rhs._melodicRhythm, arrayLen);
-			}
-
-			_harmonicNotes = rhs._harmonicNotes;
-			// If the source has harmony data, copy it
-			if (rhs._harmonicData) {
-				_harmonicData = new Chord[_harmonicNotes];
-				std::memcpy(_harmonicData, rhs._harmonicData, _harmonicNotes * sizeof(Chord));
-			}
-
-			_fitnessValue = rhs._fitnessValue;
-		}
-
-
-		~Phrase() {
-
-			if (_melodicData)    { delete[] _melodicData;    }
-			if (_melodicRhythm)  { delete[] _melodicRhythm;  }
-			if (_harmonicData)   { delete[] _harmonicData;   }
-		}
-
-		void reset() {
-
-			int arrayLen = _smallestSubdivision * _numMeasures;
-			std::memset(_melodicData, 0, arrayLen);
-			std::memset(_melodicRhythm, 0, arrayLen);
-			_melodicNotes = 0;
-			
-			std::memset(_harmonicData, 0, arrayLen * sizeof(Chord));
-			_harmonicNotes = 0;
-		}
-
-		// Melodic Information
-		char*  _melodicData;
-		char* _melodicRhythm; // Number of subdivision units
-		uint32_t _melodicNotes;
-	
-		// Harmonic Information
-		Chord* _harmonicData; // Stores Roman numeral for current key (C Major default)
-		uint32_t _harmonicNotes; // Should be 4 * _numMeasures, chords move every quarter note by default
-
-		// StatisticalInformation
-		float _fitnessValue;
-
-		// Identification Information
-		uint32_t _phraseID;
-		static uint32_t _phraseCount;
-
-		static uint32_t _numMeasures;
-		static uint32_t _smallestSubdivision;
-	};
-
-	
-
+#pragma once
+#include <cstring>
+#include <cstdint>
+#include <atomic>
+#include <new> // placement new
+
+#include "ChordDefinitions.h"
+#include "Utility/MemoryTracker.h"
+
+namespace Genetics {
+
+	// Heap block behind a phrase's melody, rhythm and chord arrays, all three in one allocation.
+	// Copies of a phrase share the block rather than duplicating it, and whichever of them writes
+	// first takes a private copy (see Phrase::makeUnique). Counted once in the memory tracker no
+	// matter how many phrases point at it.
+	// Shared per phrase rather than per measure. Breeders build children fresh and only 4-30% of the
+	// measures in a 2000 phrase population repeat one elsewhere in it, too few to pay for a header
+	// and allocation on every measure. The sharing that does pay is between the hall of fame and the
+	// population, whose best members the archive mostly holds
+	struct PhraseGenome {
+
+		static PhraseGenome* create(uint32_t byteCount) {
+
+			char* memory = new char[sizeof(PhraseGenome) + byteCount];
+			PhraseGenome* genome = new (memory) PhraseGenome();
+
+			genome->_refCount.store(1);
+			genome->_byteCount = byteCount;
+			genome->_blockID = nextBlockID();
+
+			MemoryTracker::getTracker().recordAlloc(mem_PhraseArrays, byteCount);
+			return genome;
+		}
+
+		static void release(PhraseGenome* genome) {
+
+			if (genome && genome->_refCount.fetch_sub(1) == 1) {
+
+				MemoryTracker::getTracker().recordFree(mem_PhraseArrays, genome->_byteCount);
+
+				genome->~PhraseGenome();
+				delete[] reinterpret_cast<char*>(genome);
+			}
+		}
+
+		// Never reused, so a block ID names one set of notes for as long as the program runs
+		static uint64_t nextBlockID() {
+
+			static std::atomic<uint64_t> lastBlockID(0);
+			return lastBlockID.fetch_add(1) + 1;
+		}
+
+		// Array storage starts right after the header
+		__inline char* data() { return reinterpret_cast<char*>(this + 1); }
+
+		std::atomic<uint32_t> _refCount;
+		uint32_t _byteCount;
+
+		// Identifies the notes in the block rather than the block itself. Changes whenever they're
+		// written and is carried over when the same notes are packed or unpacked into a new block
+		uint64_t _blockID;
+	};
+
+	struct Phrase {
+
+		Phrase() 
+			: _melodicData(0), _melodicRhythm(0), _melodicNotes(0), _harmonicData(0), 
+			  _harmonicNotes(0), _fitnessValue(0.0f), _fitnessKey(0), _phraseID(0), _arrayBytes(0),
+			  _genome(nullptr), _numMeasures(0), _smallestSubdivision(0), _packedNotes(0) {
+		}
+
+		// Shares the source's arrays instead of copying them, the first write to either phrase
+		// gives it a copy of its own. The copy keeps the source's ID
+		Phrase(const Phrase& rhs)
+			: _melodicData(rhs._melodicData), _melodicRhythm(rhs._melodicRhythm), _melodicNotes(rhs._melodicNotes),
+			  _harmonicData(rhs._harmonicData), _harmonicNotes(rhs._harmonicNotes), _fitnessValue(rhs._fitnessValue),
+			  _fitnessKey(rhs._fitnessKey), _phraseID(rhs._phraseID), _arrayBytes(rhs._arrayBytes), _genome(rhs._genome),
+			  _numMeasures(rhs._numMeasures), _smallestSubdivision(rhs._smallestSubdivision), _packedNotes(rhs._packedNotes) {
+
+			if (_genome) {
+				_genome->_refCount.fetch_add(1);
+			}
+		}
+
+		// Use shareGenome to point an existing phrase at another's notes
+		Phrase& operator=(const Phrase& rhs) = delete;
+
+		~Phrase() {
+
+			PhraseGenome::release(_genome);
+		}
+
+		// Fresh zeroed arrays sized for the given shape, the phrase must not own any yet
+		void allocateArrays(uint32_t measureCount, uint32_t subdivision) {
+
+			_numMeasures = static_cast<uint16_t>(measureCount);
+			_smallestSubdivision = static_cast<uint16_t>(subdivision);
+
+			// Space for a note every subdivision to make later operations easier
+			uint32_t maxNotes = measureCount * subdivision;
+
+			PhraseGenome* genome = PhraseGenome::create(2 * maxNotes + measureCount * 4 * sizeof(Chord));
+			std::memset(genome->data(), 0, genome->_byteCount);
+
+			attachGenome(genome);
+		}
+
+		// Drops this phrase's hold on the note arrays but keeps the fitness and ID, used when the
+		// notes are stored elsewhere
+		void releaseArrays() {
+
+			PhraseGenome::release(_genome);
+
+			_genome = nullptr;
+			_melodicData = nullptr;
+			_melodicRhythm = nullptr;
+			_harmonicData = nullptr;
+			_arrayBytes = 0;
+			_packedNotes = 0;
+		}
+
+		// Has to be called before writing to the arrays of a phrase that may have been copied. If
+		// they're still shared the phrase gets its own copy to write to, otherwise nothing happens
+		void makeUnique() {
+
+			if (_genome && _genome->_refCount.load() > 1) {
+
+				PhraseGenome* copy = PhraseGenome::create(_genome->_byteCount);
+				std::memcpy(copy->data(), _genome->data(), _genome->_byteCount);
+
+				PhraseGenome::release(_genome);
+				attachGenome(copy);
+			}
+			else if (_genome) {
+
+				// Written in place, so the notes are about to stop being the ones the ID named
+				_genome->_blockID = PhraseGenome::nextBlockID();
+			}
+		}
+
+		// Replaces this phrase's notes with the source's by sharing its arrays, both phrases need the
+		// same shape. Fitness and ID are left alone
+		void shareGenome(const Phrase& source) {
+
+			if (source._genome) {
+				source._genome->_refCount.fetch_add(1);
+			}
+			PhraseGenome::release(_genome);
+
+			_genome = source._genome;
+			_melodicData = source._melodicData;
+			_melodicRhythm = source._melodicRhythm;
+			_harmonicData = source._harmonicData;
+			_arrayBytes = source._arrayBytes;
+			_packedNotes = source._packedNotes;
+
+			_melodicNotes = source._melodicNotes;
+			_harmonicNotes = source._harmonicNotes;
+		}
+
+		// The block holds the packed form (see PackedGenome.h) instead of the arrays, which are null
+		// until the phrase is unpacked again
+		__inline bool isPacked() const { return _genome != nullptr && _melodicData == nullptr; }
+
+		// Cache key for anything derived from the notes alone, like the fitness. Equal keys mean
+		// equal notes, 0 means the phrase has none
+		__inline uint64_t getGenomeKey() const { return _genome ? _genome->_blockID : 0; }
+
+		void reset() {
+
+			makeUnique();
+
+			int arrayLen = _smallestSubdivision * _numMeasures;
+			std::memset(_melodicData, 0, arrayLen);
+			std::memset(_melodicRhythm, 0, arrayLen);
+			_melodicNotes = 0;
+			
+			std::memset(_harmonicData, 0, _numMeasures * 4 * sizeof(Chord));
+			_harmonicNotes = 0;
+		}
+
+		// Melodic Information
+		char*  _melodicData;
+		char* _melodicRhythm; // Number of subdivision units
+		uint32_t _melodicNotes;
+	
+		// Harmonic Information
+		Chord* _harmonicData; // Stores Roman numeral for current key (C Major default)
+		uint32_t _harmonicNotes; // Should be 4 * _numMeasures, chords move every quarter note by default
+
+		// StatisticalInformation
+		float _fitnessValue;
+		uint64_t _fitnessKey; // Genome key _fitnessValue was scored for, 0 if it hasn't been
+
+		// Identification Information, handed out by the pool that allocated the phrase so every
+		// controller numbers its own phrases
+		uint32_t _phraseID;
+
+		// Size of the arrays above, for memory accounting. Phrases sharing arrays each report the
+		// full size here, the tracker only counts the shared block once
+		uint32_t _arrayBytes;
+
+		// Block the arrays point into, possibly shared with copies of this phrase
+		PhraseGenome* _genome;
+
+		// Shape the arrays were sized for, set by the pool that allocated the phrase. Kept on the
+		// phrase rather than globally so populations of different shapes can run side by side
+		uint16_t _numMeasures;
+		uint16_t _smallestSubdivision;
+
+		// Notes in the packed block, only meaningful while isPacked()
+		uint32_t _packedNotes;
+
+	private:
+		// Points the arrays at a block laid out as melody, rhythm then chords for the current shape
+		void attachGenome(PhraseGenome* genome) {
+
+			uint32_t maxNotes = _numMeasures * _smallestSubdivision;
+
+			_genome = genome;
+			_melodicData = genome->data();
+			_melodicRhythm = genome->data() + maxNotes;
+			_harmonicData = reinterpret_cast<Chord*>(genome->data() + 2 * maxNotes);
+			_arrayBytes = genome->_byteCount;
+			_packedNotes = 0;
+		}
+	};
+
+	
+
 } // namespace Genetics
\ No newline at end of file
@@ -1,75 +1,164 @@
-#pragma once
-
-#include <vector>
-
-#include "Phrase.h"
-#include "PoolAllocator.h"
-
-namespace Genetics {
-
-	using PhraseVec = std::vector<Phrase*>;
-
-	struct PhraseFitnessSorter {
-
-		bool operator()(Phrase* lhs, Phrase* rhs) {
-
-			return lhs->_fitnessValue > rhs->_fitnessValue;
-		}
-	};
-
-	struct ElitistPrune {
-
-		static void Merge(PoolAllocator<Phrase>* poolAlloc, PhraseVec& parents, PhraseVec& children);
-	};
-
-	struct GenerationalPrune {
-		
-		static void Merge(PoolAllocator<Phrase>* poolAlloc, PhraseVec& parents, PhraseVec& children);
-	};
-
-	struct TruncationPrune {
-		
-		static void Merge(PoolAllocator<Phrase>* poolAlloc, PhraseVec& parents, PhraseVec& children);
-	};
-
-	
-	class PhrasePool{
-
-	public:
-		PhrasePool(PoolAllocator<Phrase>* poolAlloc, unsigned measureCount, unsigned subDivision);
-		~PhrasePool();
-
-		Phrase* AllocateChild();
-
-		__inline unsigned GetNumParents() const { return static_cast<unsigned>(m_population.size()); }
-		const std::vector<Phrase*>& GetPhrases() const { return m_population; }
-
-		__inline unsigned GetNumChildren() const { return static_cast<unsigned>(m_childPopulation.size()); }
-		const std::vector<Phrase*>& GetChildren() const { return m_childPopulation; }
-
-		__inline unsigned GetMeasuresPerPhrase() const { return m_measureCount; }
-		__inline unsigned GetSmallestSubDivision() const { return m_subDivision; }
-		__inline unsigned GetMaxNotes() const { return m_measureCount * m_subDivision; }
-
-
-		template <class PruningPolicy>
-		void MergeChildrenToPopulation();
-
-		unsigned GetPhraseNumberOf(Phrase* phrase) const;
-		void DisplayRatings() const;
-
-	private:
-		std::vector<Phrase*> m_population;
-		std::vector<Phrase*> m_childPopulation;
-		PoolAllocator<Phrase>* m_poolAllocator;
-
-		const unsigned m_measureCount;
-		const unsigned m_subDivision;
-	};
-
-	template <class PruningPolicy>
-	void PhrasePool::MergeChildrenToPopulation() {
-		PruningPolicy::Merge(m_poolAllocator, m_population, m_childPopulation);
-	}
-
+#pragma once
+
+#include <vector>
+#include <random>
+
+#include "Phrase.h"
+#include "PoolAllocator.h"
+#include "FitnessHeap.h"
+
+namespace Genetics {
+
+	using PhraseVec = std::vector<Phrase*>;
+
+	struct PhraseFitnessSorter {
+
+		bool operator()(Phrase* lhs, Phrase* rhs) {
+
+			return lhs->_fitnessValue > rhs->_fitnessValue;
+		}
+	};
+
+	struct ElitistPrune {
+
+		static void Merge(PoolAllocator<Phrase>* poolAlloc, PhraseVec& parents, PhraseVec& children);
+	};
+
+	struct GenerationalPrune {
+		
+		static void Merge(PoolAllocator<Phrase>* poolAlloc, PhraseVec& parents, PhraseVec& children);
+	};
+
+	struct TruncationPrune {
+		
+		static void Merge(PoolAllocator<Phrase>* poolAlloc, PhraseVec& parents, PhraseVec& children);
+	};
+
+	// Steady state replacement policies, pick the population slot a new child will overwrite
+	struct ReplaceWorst {
+
+		// Children that can't beat the current worst member are discarded
+		static constexpr bool AlwaysReplace = false;
+
+		static uint32_t SelectVictim(const FitnessHeap& heap, const PhraseVec& population, std::mt19937& engine);
+	};
+
+	struct ReverseTournamentReplace {
+
+		// Loser of the tournament always goes, keeps a bit more diversity than replacing the worst
+		static constexpr bool AlwaysReplace = true;
+
+		static uint32_t SelectVictim(const FitnessHeap& heap, const PhraseVec& population, std::mt19937& engine);
+	};
+	
+	class PhrasePool{
+
+	public:
+		PhrasePool(PoolAllocator<Phrase>* poolAlloc, unsigned measureCount, unsigned subDivision);
+		~PhrasePool();
+
+		Phrase* AllocateChild();
+
+		__inline unsigned GetNumParents() const { return static_cast<unsigned>(m_population.size()); }
+		const std::vector<Phrase*>& GetPhrases() const { return m_population; }
+
+		__inline unsigned GetNumChildren() const { return static_cast<unsigned>(m_childPopulation.size()); }
+		const std::vector<Phrase*>& GetChildren() const { return m_childPopulation; }
+
+		__inline unsigned GetMeasuresPerPhrase() const { return m_measureCount; }
+		__inline unsigned GetSmallestSubDivision() const { return m_subDivision; }
+		__inline unsigned GetMaxNotes() const { return m_measureCount * m_subDivision; }
+
+		// IDs handed out so far, children are numbered from one in the order they're allocated. Only
+		// set when restoring a saved run so new children carry on from where it left off
+		__inline uint32_t GetLastPhraseID() const { return m_lastPhraseID; }
+		__inline void SetLastPhraseID(uint32_t phraseID) { m_lastPhraseID = phraseID; }
+
+		__inline uint32_t GetAllocatedCount() const { return m_poolAllocator->size(); }
+		__inline uint32_t GetAllocatorCapacity() const { return m_poolAllocator->capacity(); }
+
+
+		template <class PruningPolicy>
+		void MergeChildrenToPopulation();
+
+		// Steady state: moves the newest child straight into the population over a victim
+		// chosen by the policy. Returns false if the child was rejected and freed instead
+		template <class ReplacementPolicy>
+		bool ReplaceIntoPopulation();
+
+		// Orders the population best first, steady state leaves it in heap order otherwise
+		void SortPopulation();
+
+		// Packed population mode. Bulk packing works through the population and children in parallel,
+		// the single phrase versions are for the operator boundary where one or two are needed as grids
+		void PackPopulation();
+		void UnpackPopulation();
+		bool PackPhrase(Phrase* phrase);
+		void UnpackPhrase(Phrase* phrase);
+
+		// Frees every child without merging, for callers that produce children they don't want to keep
+		void ReleaseChildren();
+
+		void SeedReplacement(uint32_t seed) { m_replacementEngine.seed(seed); }
+		std::mt19937* GetReplacementEngine() { return &m_replacementEngine; }
+
+		unsigned GetPhraseNumberOf(Phrase* phrase) const;
+		void DisplayRatings() const;
+
+	private:
+		std::vector<Phrase*> m_population;
+		std::vector<Phrase*> m_childPopulation;
+		PoolAllocator<Phrase>* m_poolAllocator;
+
+		// Tracks the worst member for steady state replacement, rebuilt lazily after merges/sorts
+		FitnessHeap m_fitnessHeap;
+		bool m_heapValid;
+
+		std::mt19937 m_replacementEngine;
+
+		uint32_t m_lastPhraseID;
+
+		// Packs into here before the exactly sized block is made, big enough for any phrase of the shape
+		std::vector<char> m_packScratch;
+
+		const unsigned m_measureCount;
+		const unsigned m_subDivision;
+	};
+
+	template <class PruningPolicy>
+	void PhrasePool::MergeChildrenToPopulation() {
+		PruningPolicy::Merge(m_poolAllocator, m_population, m_childPopulation);
+		m_heapValid = false;
+	}
+
+	template <class ReplacementPolicy>
+	bool PhrasePool::ReplaceIntoPopulation() {
+
+		if (m_childPopulation.empty() || m_population.empty()) {
+			return false;
+		}
+
+		if (!m_heapValid) {
+
+			m_fitnessHeap.build(m_population);
+			m_heapValid = true;
+		}
+
+		Phrase* child = m_childPopulation.back();
+		m_childPopulation.pop_back();
+
+		uint32_t victim = ReplacementPolicy::SelectVictim(m_fitnessHeap, m_population, m_replacementEngine);
+		if (!ReplacementPolicy::AlwaysReplace && child->_fitnessValue <= m_population[victim]->_fitnessValue) {
+
+			m_poolAllocator->free(child);
+			return false;
+		}
+
+		m_poolAllocator->free(m_population[victim]);
+		m_population[victim] = child;
+
+		m_fitnessHeap.update(victim, child->_fitnessValue);
+		return true;
+	}
+
 } // namespace Genetics
\ No newline at end of file
@@ -0,0 +1,200 @@
+// Morgen Hyde
+#pragma once
+
+#include "Phrase.h"
+#include "Generation/RhythmDictionary.h"
+
+#include <cstdint>
+#include <vector>
+#include <algorithm> // std::min
+
+#if defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+	#define GA_SLOT_SSE2
+	#include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+	#include <intrin.h> // _BitScanForward
+#endif
+
+namespace Genetics {
+
+	// Nearly every run is 4, 8 or 16 measures of sixteenths. Kernels are written once against a shape
+	// type and get an instantiation for each of those where the slot count is a compile time constant,
+	// so their loops have fixed trip counts the compiler can unroll and vectorize. Any other shape
+	// runs the same kernel with the dimensions read off the phrase
+	template <uint32_t Measures, uint32_t Subdivision>
+	struct FixedShape {
+
+		static constexpr uint32_t MaxNotes = Measures * Subdivision;
+
+		constexpr uint32_t measureCount() const { return Measures; }
+		constexpr uint32_t subdivision() const { return Subdivision; }
+		constexpr uint32_t maxNotes() const { return MaxNotes; }
+	};
+
+	struct DynamicShape {
+
+		DynamicShape(uint32_t measureCount, uint32_t subdivision)
+			: m_measureCount(measureCount), m_subdivision(subdivision) {
+		}
+
+		__inline uint32_t measureCount() const { return m_measureCount; }
+		__inline uint32_t subdivision() const { return m_subdivision; }
+		__inline uint32_t maxNotes() const { return m_measureCount * m_subdivision; }
+
+	private:
+		uint32_t m_measureCount;
+		uint32_t m_subdivision;
+	};
+
+	// Longest phrase a file may ask for, far past anything the UI offers but small enough that the
+	// slot count can't overflow
+	constexpr uint32_t MaxPhraseMeasures = 1024;
+
+	// Shapes the kernels and operators can work on: at least one measure, each a power of two slots
+	// the RhythmDictionary can split into binary patterns. Anything read from a file should be
+	// checked against this before a pool is built at its shape
+	__inline bool isSupportedShape(uint32_t measureCount, uint32_t subdivision) {
+
+		return measureCount != 0 && measureCount <= MaxPhraseMeasures && RhythmDictionary::supports(subdivision);
+	}
+
+	// Calls kernel(shape) with the most specific shape that matches the phrase
+	template <typename Kernel>
+	auto dispatchShape(const Phrase* phrase, Kernel kernel) -> decltype(kernel(DynamicShape(0, 0))) {
+
+		if (phrase->_smallestSubdivision == 16) {
+
+			switch (phrase->_numMeasures) {
+			case 4:  return kernel(FixedShape<4, 16>());
+			case 8:  return kernel(FixedShape<8, 16>());
+			case 16: return kernel(FixedShape<16, 16>());
+			default: break;
+			}
+		}
+
+		return kernel(DynamicShape(phrase->_numMeasures, phrase->_smallestSubdivision));
+	}
+
+	// One value per slot, kept on the stack when the shape is known at compile time
+	template <typename Shape, typename T>
+	class SlotBuffer {
+
+	public:
+		explicit SlotBuffer(const Shape& shape) { }
+		__inline T* data() { return m_data; }
+
+	private:
+		T m_data[Shape::MaxNotes];
+	};
+
+	template <typename T>
+	class SlotBuffer<DynamicShape, T> {
+
+	public:
+		explicit SlotBuffer(const DynamicShape& shape) : m_data(shape.maxNotes()) { }
+		__inline T* data() { return m_data.data(); }
+
+	private:
+		std::vector<T> m_data;
+	};
+
+	// Slot arrays are scanned in 16 slot blocks, each block turned into a bitmask with one bit per
+	// slot. SSE2 builds the mask with a single compare, everything else (and the tail of the array)
+	// falls back to a byte loop, so the logic after the mask is the same on every platform
+	constexpr uint32_t SlotBlockSize = 16;
+
+	__inline uint32_t blockBits(uint32_t count) {
+
+		return (count >= 32) ? 0xFFFFFFFFu : (1u << count) - 1;
+	}
+
+	// Bit i is set if data[i] is zero, only the low count bits are meaningful
+	__inline uint32_t zeroMask(const char* data, uint32_t count) {
+
+#ifdef GA_SLOT_SSE2
+		if (count == SlotBlockSize) {
+
+			__m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+			return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, _mm_setzero_si128())));
+		}
+#endif
+		uint32_t mask = 0;
+		for (uint32_t i = 0; i < count; ++i) {
+
+			if (data[i] == 0) {
+				mask |= 1u << i;
+			}
+		}
+
+		return mask;
+	}
+
+	// Portable popcount, the POPCNT instruction isn't guaranteed on every x64 machine
+	__inline uint32_t countBits(uint32_t bits) {
+
+		bits = bits - ((bits >> 1) & 0x55555555u);
+		bits = (bits & 0x33333333u) + ((bits >> 2) & 0x33333333u);
+		bits = (bits + (bits >> 4)) & 0x0F0F0F0Fu;
+		return (bits * 0x01010101u) >> 24;
+	}
+
+	__inline uint32_t lowestBit(uint32_t bits) {
+
+#if defined(_MSC_VER)
+		unsigned long index;
+		_BitScanForward(&index, bits);
+		return static_cast<uint32_t>(index);
+#else
+		return static_cast<uint32_t>(__builtin_ctz(bits));
+#endif
+	}
+
+	// Bit i is set if a note starts at rhythm[i]
+	__inline uint32_t noteMask(const char* rhythm, uint32_t count) {
+
+		return ~zeroMask(rhythm, count) & blockBits(count);
+	}
+
+	// Packs the value at every note start into packed, in order, and returns how many notes there
+	// were. Notes are found a block at a time from the rhythm mask rather than by hopping from one
+	// note to the next, so the loads don't depend on each other. packed needs room for maxNotes values
+	template <typename Shape>
+	uint32_t gatherNotes(const Shape& shape, const char* slots, const char* rhythm, char* packed) {
+
+		const uint32_t arrayLen = shape.maxNotes();
+		uint32_t noteCount = 0;
+
+		for (uint32_t base = 0; base < arrayLen; base += SlotBlockSize) {
+
+			uint32_t notes = noteMask(rhythm + base, std::min(SlotBlockSize, arrayLen - base));
+			while (notes != 0) {
+
+				packed[noteCount++] = slots[base + lowestBit(notes)];
+				notes &= notes - 1;
+			}
+		}
+
+		return noteCount;
+	}
+
+	// Inverse of gatherNotes, writes packed values back over the note starts and leaves the rest alone
+	template <typename Shape>
+	void scatterNotes(const Shape& shape, const char* packed, const char* rhythm, char* slots) {
+
+		const uint32_t arrayLen = shape.maxNotes();
+		uint32_t noteCount = 0;
+
+		for (uint32_t base = 0; base < arrayLen; base += SlotBlockSize) {
+
+			uint32_t notes = noteMask(rhythm + base, std::min(SlotBlockSize, arrayLen - base));
+			while (notes != 0) {
+
+				slots[base + lowestBit(notes)] = packed[noteCount++];
+				notes &= notes - 1;
+			}
+		}
+	}
+
+} // namespace Genetics
@@ -0,0 +1,59 @@
+// Morgen Hyde
+#pragma once
+
+#include "Utility/MappedFile.h"
+
+#include <string>
+#include <fstream>
+#include <cstdint>
+
+namespace Genetics {
+
+	struct Phrase;
+
+	constexpr uint64_t InvalidSpillOffset = ~static_cast<uint64_t>(0);
+
+	// Append only store for phrases that don't need to stay on the heap. Records use the checkpoint
+	// layout, packed where possible, writes go through a stream and reads come out of a mapping of
+	// the same file that's refreshed whenever a record past its end is asked for. Records are packed
+	// against one shape, so the file takes the shape of the first phrase appended and turns away
+	// any other
+	class PhraseSpillFile {
+
+	public:
+		PhraseSpillFile();
+		~PhraseSpillFile();
+
+		PhraseSpillFile(const PhraseSpillFile& rhs) = delete;
+		PhraseSpillFile& operator=(const PhraseSpillFile& rhs) = delete;
+
+		// Truncates the file
+		bool open(const std::string& filepath);
+		void close();
+
+		__inline bool isOpen() const { return m_writer.is_open(); }
+		__inline uint64_t size() const { return m_fileSize; }
+
+		__inline uint32_t getMeasureCount() const { return m_measureCount; }
+		__inline uint32_t getSubdivision() const { return m_subdivision; }
+
+		// Returns where the record was written, InvalidSpillOffset if it couldn't be or the phrase
+		// doesn't have the file's shape
+		uint64_t append(const Phrase* phrase);
+
+		// The phrase needs arrays allocated for the file's shape
+		bool read(uint64_t offset, Phrase* phrase);
+
+	private:
+		std::string m_filepath;
+		std::ofstream m_writer;
+		MappedFile m_view;
+
+		uint32_t m_measureCount;
+		uint32_t m_subdivision;
+		uint32_t m_recordSize; // Largest a record can be
+
+		uint64_t m_fileSize;
+	};
+
+} // namespace Genetics
@@ -1,16 +1,17 @@
-#pragma once
-
-#include "Fitness/FitnessEvaluator.h"
-#include "Selection/Selector.h"
-#include "Breeding/Breeder.h"
-#include "Mutation/Mutator.h"
-
-namespace Genetics {
-
-	using FitnessType   = FitnessEvaluator<AutomaticFitness>;
-	using SelectionType = Selection<TournamentSelection>;
-    using BreederType   = BreedingMethod<InterpolateBreed>;
-//  using MutationType  = Mutation<>;
-	using PruningType   = ElitistPrune;
-
+#pragma once
+
+#include "Fitness/FitnessEvaluator.h"
+#include "Selection/Selector.h"
+#include "Breeding/Breeder.h"
+#include "Mutation/Mutator.h"
+
+namespace Genetics {
+
+	using FitnessType   = FitnessEvaluator<AutomaticFitness>;
+	using SelectionType = Selection<TournamentSelection>;
+    using BreederType   = BreedingMethod<InterpolateBreed>;
+//  using MutationType  = Mutation<>;
+	using PruningType   = ElitistPrune;
+	using ReplacementType = ReplaceWorst;
+
 } // namespace Genetics
\ No newline at end of file
@@ -1,73 +1,83 @@
-#pragma once
-
-#include <utility>
-#include <random>
-
-namespace Genetics {
-
-	class PhrasePool;
-	struct Phrase;
-
-	typedef std::pair<Phrase*, Phrase*> BreedingPair;
-
-	struct RouletteSelection
-	{
-	public:
-		RouletteSelection();
-		~RouletteSelection();
-
-	protected:
-		BreedingPair Select(PhrasePool* phrasePopulation);
-
-	private:
-		std::mt19937 m_randomEngine;
-
-	};
-
-	struct TournamentSelection {
-
-	public:
-		TournamentSelection();
-		~TournamentSelection();
-
-		void SetNumRounds(unsigned numRounds = 1);
-		void SetParentPoolSize(unsigned numPossibleParents = 2);
-
-	protected:
-		BreedingPair Select(PhrasePool* phrasePopulation);
-	
-	private:
-		Phrase* RunTournament(const std::vector<Phrase*>& population, int parents);
-
-		unsigned m_numRounds;
-		unsigned m_possibleParents;
-
-		std::mt19937 m_randomEngine;
-	};
-
-
-	template <class SelectorPolicy = RouletteSelection>
-	class Selection : public SelectorPolicy
-	{
-	public:
-		Selection();
-		~Selection();
-
-		BreedingPair SelectPair(PhrasePool* phrasePopulation);
-	};
-
-	template <class Policy>
-	Selection<Policy>::Selection() {
-	}
-
-	template <class Policy>
-	Selection<Policy>::~Selection() {
-	}
-
-	template <class Policy>
-	BreedingPair Selection<Policy>::SelectPair(PhrasePool* phrasePopulation)
-	{
-		return Policy::Select(phrasePopulation);
-	}
-
+#pragma once
+
+#include <utility>
+#include <random>
+#include <cstdint>
+
+namespace Genetics {
+
+	class PhrasePool;
+	struct Phrase;
+
+	typedef std::pair<Phrase*, Phrase*> BreedingPair;
+
+	struct RouletteSelection
+	{
+	public:
+		RouletteSelection();
+		~RouletteSelection();
+
+		// Fixed seeds for reproducible runs and benchmarks
+		void Seed(uint32_t seed);
+
+		// Saved and restored with checkpoints
+		__inline std::mt19937* GetRandomEngine() { return &m_randomEngine; }
+
+	protected:
+		BreedingPair Select(PhrasePool* phrasePopulation);
+
+	private:
+		std::mt19937 m_randomEngine;
+
+	};
+
+	struct TournamentSelection {
+
+	public:
+		TournamentSelection();
+		~TournamentSelection();
+
+		void Seed(uint32_t seed);
+		__inline std::mt19937* GetRandomEngine() { return &m_randomEngine; }
+
+		void SetNumRounds(unsigned numRounds = 1);
+		void SetParentPoolSize(unsigned numPossibleParents = 2);
+
+	protected:
+		BreedingPair Select(PhrasePool* phrasePopulation);
+	
+	private:
+		Phrase* RunTournament(const std::vector<Phrase*>& population, int parents);
+
+		unsigned m_numRounds;
+		unsigned m_possibleParents;
+
+		std::mt19937 m_randomEngine;
+	};
+
+
+	template <class SelectorPolicy = RouletteSelection>
+	class Selection : public SelectorPolicy
+	{
+	public:
+		Selection();
+		~Selection();
+
+		BreedingPair SelectPair(PhrasePool* phrasePopulation);
+	};
+
+	template <class Policy>
+	Selection<Policy>::Selection() {
+	}
+
+	template <class Policy>
+	Selection<Policy>::~Selection() {
+	}
+
+	template <class Policy>
+	BreedingPair Selection<Policy>::SelectPair(PhrasePool* phrasePopulation)
+	{
+		return Policy::Select(phrasePopulation);
+	}
+
 } // namespace Genetic
\ No newline at end of file
@@ -0,0 +1,109 @@
+// Morgen Hyde
+#pragma once
+
+#include <vector>
+#include <string>
+#include <chrono>
+#include <cstdint>
+
+namespace Genetics {
+
+	struct Phrase;
+
+	enum GenerationStage {
+
+		stage_Selection = 0,
+		stage_Breeding,
+		stage_Mutation,
+		stage_Assessment,
+		stage_Merge,
+		stage_Packing,  // Packing and unpacking population members, only with a packed population
+		stage_Count
+	};
+
+	// One record per generation. Plain old data so the binary export is just the raw array
+	struct GenerationStats {
+
+		uint32_t m_generation;
+
+		float m_minFitness;
+		float m_meanFitness;
+		float m_maxFitness;
+		float m_stdDevFitness;
+
+		uint32_t m_uniqueGenomes;
+
+		// Throughput
+		uint32_t m_childrenProduced;
+		float m_generationMs;
+		float m_childrenPerSecond;
+
+		// Time spent in each operator this generation, summed over every child
+		float m_stageMs[stage_Count];
+
+		// Phrase pool allocator usage at the end of the generation
+		uint32_t m_allocatorUsed;
+		uint32_t m_allocatorCapacity;
+	};
+
+	// Accumulates elapsed milliseconds into a stage counter for as long as it's in scope
+	class StageTimer {
+
+	public:
+		StageTimer(double& accumulator)
+			: m_accumulator(accumulator), m_start(std::chrono::steady_clock::now()) {
+		}
+
+		~StageTimer() {
+			m_accumulator += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_start).count();
+		}
+
+	private:
+		double& m_accumulator;
+		std::chrono::steady_clock::time_point m_start;
+	};
+
+	// Fixed size ring buffer of generation records. Everything is allocated up front so recording
+	// from the run loop never touches the heap, once full the oldest generations are overwritten
+	class TelemetryRecorder {
+
+	public:
+		TelemetryRecorder(uint32_t capacity);
+		~TelemetryRecorder();
+
+		// Fills in the fitness summary from the population and stores the record
+		void recordGeneration(const std::vector<Phrase*>& population, GenerationStats& stats);
+
+		void clear();
+
+		__inline uint32_t size() const { return m_count; }
+		__inline uint32_t capacity() const { return static_cast<uint32_t>(m_records.size()); }
+
+		// Oldest first, index 0 is the oldest record still in the buffer
+		const GenerationStats& getRecord(uint32_t index) const;
+		const GenerationStats* getLatest() const;
+
+		// Export by extension, ".csv" writes text and anything else writes the binary format
+		bool exportToFile(const std::string& filepath) const;
+
+		bool exportCSV(const std::string& filepath) const;
+		bool exportBinary(const std::string& filepath) const;
+
+	private:
+		std::vector<GenerationStats> m_records;
+		uint32_t m_head;  // Next slot to write
+		uint32_t m_count;
+	};
+
+	// Binary layout: header followed by m_recordCount raw GenerationStats records, oldest first
+	struct TelemetryFileHeader {
+
+		char m_magic[4];         // "GMTL"
+		uint32_t m_version;
+		uint32_t m_recordSize;   // sizeof(GenerationStats) when written, lets readers detect layout changes
+		uint32_t m_recordCount;
+	};
+
+	constexpr uint32_t TelemetryFileVersion = 2;
+
+} // namespace Genetics
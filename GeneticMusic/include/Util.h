@@ -1,3 +1,3 @@
-#pragma once
-
+#pragma once
+
 #include <cstdint>
\ No newline at end of file
@@ -1,24 +1,37 @@
-// Morgen Hyde
-#pragma once
-
-#include <cstdint>
-#include <string>
-
-// This file contains objects and functions to perform regular error checking on a particular object to detect 
-// an error and alert the user to the problem
-
-namespace Genetics {
-
-	struct Phrase;
-	typedef uint32_t GA_Error;
-
-	std::string readErrorMessage(GA_Error errorCode);
-	void printErrorMessage(GA_Error errorCode);
-
-	GA_Error validateNoteCount(Phrase* phrase);
-
-	GA_Error validateNoteLengths(Phrase* phrase);
-
-	GA_Error validateRestOccurances(Phrase* phrase);
-
+// Morgen Hyde
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+// This file contains objects and functions to perform regular error checking on a particular object to detect 
+// an error and alert the user to the problem
+
+namespace Genetics {
+
+	struct Phrase;
+	typedef uint32_t GA_Error;
+
+	enum GA_ErrorCodes {
+
+		enm_noError = 0,
+		enm_noteCountMismatch,
+		enm_noteLengthTooShort,
+		enm_noteLengthTooLong,
+		enm_restFound,
+		enm_errorCount
+	};
+
+	std::string readErrorMessage(GA_Error errorCode);
+	void printErrorMessage(GA_Error errorCode);
+
+	GA_Error validateNoteCount(Phrase* phrase);
+
+	GA_Error validateNoteLengths(Phrase* phrase);
+
+	GA_Error validateRestOccurances(Phrase* phrase);
+
+	// All three of the above, stops at the first failure
+	GA_Error validatePhrase(Phrase* phrase);
+
 } // namespace Genetics
\ No newline at end of file
@@ -0,0 +1,15 @@
+// Morgen Hyde
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace Genetics {
+
+	// Appends the path (directory joined to the name) of every regular file in the directory whose
+	// extension matches one of the given ones, ignoring case (".mid", ".midi", ...). Subdirectories
+	// aren't searched. Paths come back sorted so the order doesn't depend on the filesystem.
+	// Returns false if the directory can't be opened
+	bool listFiles(const std::string& directory, const std::vector<std::string>& extensions, std::vector<std::string>& filepaths);
+
+} // namespace Genetics
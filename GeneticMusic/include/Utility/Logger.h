@@ -0,0 +1,182 @@
+// Morgen Hyde
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdarg>
+#include <cstdint>
+#include <memory>
+#include <thread>
+
+// Leveled logging for code that runs inside the algorithm loop. Messages below GA_LOG_LEVEL are
+// removed by the preprocessor, arguments included, so release builds pay nothing for them.
+//
+//   GA_LOG_TRACE("Picked %s mutation", name);   per operator chatter, off unless asked for
+//   GA_LOG_DEBUG(...) / GA_LOG_INFO(...)        defaults on in _DEBUG builds
+//   GA_LOG_WARNING(...) / GA_LOG_ERROR(...)     defaults on everywhere
+//
+// GA_LOG_LEVEL can be set in the project preprocessor settings to any of the GA_LOG_LEVEL_ values.
+// Callers format into a fixed size record and push it onto a lock-free queue, a background thread
+// does the actual printing. Each call site is limited to LogRateLimit messages per LogRateWindowMs,
+// anything past that is counted and reported with the next message that gets through.
+
+#define GA_LOG_LEVEL_TRACE   0
+#define GA_LOG_LEVEL_DEBUG   1
+#define GA_LOG_LEVEL_INFO    2
+#define GA_LOG_LEVEL_WARNING 3
+#define GA_LOG_LEVEL_ERROR   4
+#define GA_LOG_LEVEL_NONE    5
+
+#ifndef GA_LOG_LEVEL
+	#ifdef _DEBUG
+		#define GA_LOG_LEVEL GA_LOG_LEVEL_DEBUG
+	#else
+		#define GA_LOG_LEVEL GA_LOG_LEVEL_WARNING
+	#endif
+#endif
+
+// The static site lives in the caller, so every call site gets its own rate limit
+#define GA_LOG_AT(level, ...) \
+	do { \
+		static ::Genetics::LogSite s_logSite(__FILE__, __LINE__); \
+		::Genetics::Logger::getLogger().write(level, s_logSite, __VA_ARGS__); \
+	} while (false)
+
+#if GA_LOG_LEVEL <= GA_LOG_LEVEL_TRACE
+	#define GA_LOG_TRACE(...) GA_LOG_AT(::Genetics::log_Trace, __VA_ARGS__)
+#else
+	#define GA_LOG_TRACE(...) ((void)0)
+#endif
+
+#if GA_LOG_LEVEL <= GA_LOG_LEVEL_DEBUG
+	#define GA_LOG_DEBUG(...) GA_LOG_AT(::Genetics::log_Debug, __VA_ARGS__)
+#else
+	#define GA_LOG_DEBUG(...) ((void)0)
+#endif
+
+#if GA_LOG_LEVEL <= GA_LOG_LEVEL_INFO
+	#define GA_LOG_INFO(...) GA_LOG_AT(::Genetics::log_Info, __VA_ARGS__)
+#else
+	#define GA_LOG_INFO(...) ((void)0)
+#endif
+
+#if GA_LOG_LEVEL <= GA_LOG_LEVEL_WARNING
+	#define GA_LOG_WARNING(...) GA_LOG_AT(::Genetics::log_Warning, __VA_ARGS__)
+#else
+	#define GA_LOG_WARNING(...) ((void)0)
+#endif
+
+#if GA_LOG_LEVEL <= GA_LOG_LEVEL_ERROR
+	#define GA_LOG_ERROR(...) GA_LOG_AT(::Genetics::log_Error, __VA_ARGS__)
+#else
+	#define GA_LOG_ERROR(...) ((void)0)
+#endif
+
+namespace Genetics {
+
+	enum LogLevel {
+
+		log_Trace = GA_LOG_LEVEL_TRACE,
+		log_Debug = GA_LOG_LEVEL_DEBUG,
+		log_Info = GA_LOG_LEVEL_INFO,
+		log_Warning = GA_LOG_LEVEL_WARNING,
+		log_Error = GA_LOG_LEVEL_ERROR,
+		log_None = GA_LOG_LEVEL_NONE,
+	};
+
+	const char* getLogLevelName(LogLevel level);
+
+	// Per call site state for the rate limiter, only ever created by the GA_LOG_ macros
+	struct LogSite {
+
+		LogSite(const char* file, uint32_t line);
+
+		// True if this message fits in the current window, suppressed messages are counted instead
+		bool admit(uint64_t nowNs);
+
+		// Messages dropped since the last one that got through
+		__inline uint32_t takeSuppressed() { return m_suppressed.exchange(0, std::memory_order_relaxed); }
+
+		const char* m_file; // __FILE__, static lifetime
+		uint32_t m_line;
+
+		std::atomic<uint64_t> m_windowStartNs;
+		std::atomic<uint32_t> m_windowCount;
+		std::atomic<uint32_t> m_suppressed;
+	};
+
+	class Logger {
+
+	public:
+
+		// Singleton access, same pattern as the RuleManager
+		static Logger& getLogger() {
+			static Logger logger;
+			return logger;
+		}
+
+		Logger(const Logger& rhs) = delete;
+		Logger& operator=(const Logger& rhs) = delete;
+
+		~Logger();
+
+		// Runtime filter on top of the compile time one, can only quiet things further
+		__inline void setLevel(LogLevel level) { m_level.store(level, std::memory_order_relaxed); }
+		__inline LogLevel getLevel() const { return m_level.load(std::memory_order_relaxed); }
+
+		// printf style formatting, messages longer than the record are truncated
+		void write(LogLevel level, LogSite& site, const char* format, ...);
+
+		// Blocks until everything written before the call has been printed
+		void flush();
+
+		// Messages lost to a full queue since the logger started
+		__inline uint64_t getDroppedCount() const { return m_totalDropped.load(std::memory_order_relaxed); }
+
+	private:
+		Logger();
+
+		static constexpr uint32_t MessageLength = 192;
+
+		struct LogRecord {
+
+			std::atomic<uint64_t> m_sequence;
+
+			LogLevel m_level;
+			uint32_t m_threadIndex;
+			uint64_t m_timeNs;
+			const char* m_file;
+			uint32_t m_line;
+			uint32_t m_suppressed;
+			char m_message[MessageLength];
+		};
+
+		uint64_t now() const;
+
+		bool push(LogLevel level, const LogSite& site, uint64_t timeNs, uint32_t suppressed, const char* format, va_list args);
+
+		// Prints the oldest record if one is ready, only ever called from the sink thread
+		bool printNext();
+		void printDropped();
+
+		void sinkLoop();
+
+		// Bounded multi producer / single consumer ring, each slot's sequence number says whether
+		// it's ready to be written (== position) or read (== position + 1)
+		std::unique_ptr<LogRecord[]> m_records;
+		uint64_t m_mask;
+
+		alignas(64) std::atomic<uint64_t> m_writePosition;
+		alignas(64) std::atomic<uint64_t> m_readPosition;
+
+		std::atomic<uint32_t> m_dropped;
+		std::atomic<uint64_t> m_totalDropped;
+
+		std::atomic<LogLevel> m_level;
+		std::atomic<bool> m_running;
+		std::thread m_sinkThread;
+
+		std::chrono::steady_clock::time_point m_epoch;
+	};
+
+} // namespace Genetics
@@ -0,0 +1,33 @@
+// Morgen Hyde
+#pragma once
+
+#include <string>
+#include <cstddef>
+
+namespace Genetics {
+
+	// Read only view of a whole file mapped into memory. Pages are only faulted in as they're
+	// touched, so opening a large file costs next to nothing until the data is actually read
+	class MappedFile {
+
+	public:
+		MappedFile();
+		~MappedFile();
+
+		MappedFile(const MappedFile& rhs) = delete;
+		MappedFile& operator=(const MappedFile& rhs) = delete;
+
+		// Maps the file, any previous mapping is released first. Empty files can't be mapped
+		bool open(const std::string& filepath);
+		void close();
+
+		__inline bool isOpen() const { return m_data != nullptr; }
+		__inline const char* data() const { return m_data; }
+		__inline size_t size() const { return m_size; }
+
+	private:
+		const char* m_data;
+		size_t m_size;
+	};
+
+} // namespace Genetics
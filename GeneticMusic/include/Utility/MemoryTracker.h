@@ -0,0 +1,79 @@
+// Morgen Hyde
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+// Byte counters for the big consumers of memory, so population sizes can be planned against a
+// RAM budget. Owners report their allocations and frees under a tag, nothing is intercepted, so
+// the numbers only cover the hooked allocations and not the general heap.
+
+namespace Genetics {
+
+	enum MemoryTag {
+
+		mem_PhrasePool = 0, // PoolAllocator slabs holding the Phrase structs
+		mem_PhraseArrays,   // melody, rhythm and harmony arrays owned by each phrase
+		mem_SampleLibrary,  // PianoSynth sample file
+		mem_AudioBuffers,   // rendered phrases held by ActiveSound for playback
+		mem_RuleStorage,    // RuleTable rule memory and lookup table
+		mem_UI,             // everything ImGui allocates
+		mem_Count
+	};
+
+	const char* getMemoryTagName(MemoryTag tag);
+
+	struct MemoryTagStats {
+
+		uint64_t m_currentBytes;
+		uint64_t m_peakBytes;
+		uint64_t m_allocations; // allocations still outstanding
+	};
+
+	class MemoryTracker {
+
+	public:
+
+		// Singleton access, same pattern as the RuleManager
+		static MemoryTracker& getTracker() {
+			static MemoryTracker tracker;
+			return tracker;
+		}
+
+		MemoryTracker(const MemoryTracker& rhs) = delete;
+		MemoryTracker& operator=(const MemoryTracker& rhs) = delete;
+
+		// Safe to call from any thread, the audio callback included
+		void recordAlloc(MemoryTag tag, size_t bytes);
+		void recordFree(MemoryTag tag, size_t bytes);
+
+		MemoryTagStats getStats(MemoryTag tag) const;
+
+		// Sum over every tag, the peak is the highest combined total seen rather than the sum of peaks
+		MemoryTagStats getTotalStats() const;
+
+		// Drops every peak back to the current value, e.g. before measuring a single run
+		void resetPeaks();
+
+	private:
+		MemoryTracker();
+
+		struct TagCounters {
+
+			std::atomic<uint64_t> m_currentBytes;
+			std::atomic<uint64_t> m_peakBytes;
+			std::atomic<uint64_t> m_allocations;
+		};
+
+		static void raisePeak(std::atomic<uint64_t>& peak, uint64_t value);
+
+		TagCounters m_tags[mem_Count];
+		TagCounters m_total;
+	};
+
+	// ImGui allocator hooks, install with ImGui::SetAllocatorFunctions before creating the context
+	void* trackedUIAlloc(size_t bytes, void* userData);
+	void trackedUIFree(void* pointer, void* userData);
+
+} // namespace Genetics
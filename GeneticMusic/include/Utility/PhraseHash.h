@@ -0,0 +1,17 @@
+// Morgen Hyde
+#pragma once
+
+#include <cstdint>
+
+namespace Genetics {
+
+	struct Phrase;
+
+	// 64 bit FNV-1a over the melody, rhythm and harmony arrays. Two phrases with identical genomes
+	// hash the same regardless of ID or fitness, so this is what duplicate detection keys on. Needs
+	// the grid, packed phrases go through getGridView first
+	uint64_t hashPhraseGenome(const Phrase* phrase);
+
+	uint64_t hashBytes(const void* data, uint32_t byteCount, uint64_t seed);
+
+} // namespace Genetics
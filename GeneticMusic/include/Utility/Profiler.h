@@ -0,0 +1,120 @@
+// Morgen Hyde
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Scoped timer instrumentation. Everything compiles away unless GA_ENABLE_PROFILING is defined in
+// the project preprocessor settings, so the macros can be left in hot code permanently.
+//
+//   GA_PROFILE_SCOPE("Selection");   times the enclosing block under the given (literal) name
+//   GA_PROFILE_FUNCTION();           same thing named after the current function
+//
+// While a capture is running every thread writes into its own fixed size buffer without taking
+// a lock, and the buffers can be dumped as Chrome / Perfetto trace JSON (chrome://tracing).
+
+#ifdef GA_ENABLE_PROFILING
+	#define GA_PROFILE_CONCAT_INNER(a, b) a##b
+	#define GA_PROFILE_CONCAT(a, b) GA_PROFILE_CONCAT_INNER(a, b)
+
+	#define GA_PROFILE_SCOPE(name) ::Genetics::ProfileScope GA_PROFILE_CONCAT(profileScope_, __LINE__)(name)
+	#define GA_PROFILE_FUNCTION()  GA_PROFILE_SCOPE(__FUNCTION__)
+#else
+	#define GA_PROFILE_SCOPE(name)
+	#define GA_PROFILE_FUNCTION()
+#endif
+
+namespace Genetics {
+
+	struct ProfileEvent {
+
+		const char* m_name; // Must have static lifetime, only the pointer is stored
+		uint64_t m_startNs;
+		uint64_t m_durationNs;
+	};
+
+	// Events recorded by a single thread. Only the owning thread writes, the exporter reads up to
+	// the published count, so no lock is needed on either side
+	struct ProfileThreadBuffer {
+
+		ProfileThreadBuffer(uint32_t threadID, uint32_t capacity);
+
+		std::vector<ProfileEvent> m_events;
+		std::atomic<uint32_t> m_count;
+		std::atomic<uint32_t> m_dropped;
+		std::atomic<bool> m_inUse;
+
+		uint32_t m_threadID;
+	};
+
+	class Profiler {
+
+	public:
+
+		// Singleton access, same pattern as the RuleManager
+		static Profiler& getProfiler() {
+			static Profiler profiler;
+			return profiler;
+		}
+
+		Profiler(const Profiler& rhs) = delete;
+		Profiler& operator=(const Profiler& rhs) = delete;
+
+		~Profiler();
+
+		// Starting a capture clears whatever the previous one recorded
+		void setCapturing(bool capturing);
+		__inline bool isCapturing() const { return m_capturing.load(std::memory_order_relaxed); }
+
+		void record(const char* name, uint64_t startNs, uint64_t endNs);
+
+		// Nanoseconds since the profiler was created
+		uint64_t now() const;
+
+		// Writes every buffered event as Chrome trace JSON, best called after the capture is stopped
+		bool exportChromeTrace(const std::string& filepath);
+
+	private:
+		Profiler();
+
+		ProfileThreadBuffer* acquireThreadBuffer();
+		void clearBuffers();
+
+		// Buffers outlive the threads that wrote them so a trace can be exported after workers exit,
+		// a buffer released by an exited thread is handed to the next new thread
+		std::vector<std::unique_ptr<ProfileThreadBuffer>> m_buffers;
+		std::mutex m_bufferLock;
+
+		std::atomic<bool> m_capturing;
+		std::chrono::steady_clock::time_point m_epoch;
+
+		friend struct ProfileThreadHandle;
+	};
+
+	class ProfileScope {
+
+	public:
+		ProfileScope(const char* name)
+			: m_name(name), m_startNs(Profiler::getProfiler().isCapturing() ? Profiler::getProfiler().now() : 0) {
+		}
+
+		~ProfileScope() {
+
+			// Scopes that began before the capture started are skipped rather than reported half timed
+			Profiler& profiler = Profiler::getProfiler();
+			if (m_startNs != 0 && profiler.isCapturing()) {
+				profiler.record(m_name, m_startNs, profiler.now());
+			}
+		}
+
+	private:
+		const char* m_name;
+		uint64_t m_startNs;
+	};
+
+} // namespace Genetics
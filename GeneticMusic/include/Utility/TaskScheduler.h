@@ -0,0 +1,171 @@
+// Morgen Hyde
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Project wide work-stealing thread pool. Every worker owns a deque of jobs, it pushes and pops
+// from the back of its own deque and steals from the front of everyone else's when it runs dry.
+// Threads that aren't workers (the main/UI thread) submit into a shared slot 0 queue and help
+// execute jobs while they wait on a TaskGroup, so nested fork/join never deadlocks.
+
+namespace Genetics {
+
+	typedef std::function<void()> Task;
+
+	class TaskGroup;
+
+	class TaskScheduler {
+
+	public:
+
+		// Singleton access, same pattern as the RuleManager
+		static TaskScheduler& getScheduler() {
+			static TaskScheduler scheduler;
+			return scheduler;
+		}
+
+		TaskScheduler(const TaskScheduler& rhs) = delete;
+		TaskScheduler& operator=(const TaskScheduler& rhs) = delete;
+
+		~TaskScheduler();
+
+		// State management, a worker count of 0 uses (hardware threads - 1). initialize restarts the
+		// workers and shutdown stops them whoever else is using the pool, both are safe to call from
+		// any thread but only while nothing is in flight
+		void initialize(uint32_t workerCount = 0, bool pinThreads = false);
+		void shutdown();
+
+		// Shared ownership for anything that may exist alongside others, like the controllers. The
+		// first acquire starts the workers and the last release stops them, everyone in between
+		// gets the pool as it was configured
+		void acquire(uint32_t workerCount = 0, bool pinThreads = false);
+		void release();
+
+		// Restarts with a new configuration, but only for a sole user. Returns false and leaves the
+		// pool alone when someone else holds it
+		bool reconfigure(uint32_t workerCount, bool pinThreads);
+
+		__inline bool isRunning() const { return !m_workers.empty(); }
+		__inline uint32_t getWorkerCount() const { return static_cast<uint32_t>(m_workers.size()); }
+
+		// Number of distinct thread indices that can be returned by getThreadIndex
+		__inline uint32_t getThreadSlotCount() const { return getWorkerCount() + 1; }
+
+		// 0 for any thread that isn't a worker, [1, workerCount] for workers
+		static uint32_t getThreadIndex();
+
+		// Fork / Join primitives
+		void submit(TaskGroup& group, Task task);
+		void wait(TaskGroup& group);
+
+		// Splits [begin, end) into chunks of grainSize and calls body(chunkBegin, chunkEnd) for each
+		template <typename Body>
+		void parallelFor(uint32_t begin, uint32_t end, uint32_t grainSize, const Body& body);
+
+	private:
+		TaskScheduler();
+
+		struct Job {
+
+			Task m_task;
+			TaskGroup* m_group;
+		};
+
+		struct WorkQueue {
+
+			std::mutex m_lock;
+			std::deque<Job> m_jobs;
+		};
+
+		// Callers hold m_lifecycleLock
+		void startWorkers(uint32_t workerCount, bool pinThreads);
+		void stopWorkers();
+
+		void workerLoop(uint32_t workerIndex);
+
+		bool popJob(uint32_t queueIndex, Job& job);
+		bool stealJob(uint32_t thiefIndex, Job& job);
+		bool runPendingJob(uint32_t queueIndex);
+
+		void finishJob(Job& job);
+
+		// Queue 0 is shared by non-worker threads, queue N belongs to worker N
+		std::vector<std::unique_ptr<WorkQueue>> m_queues;
+		std::vector<std::thread> m_workers;
+
+		std::mutex m_sleepLock;
+		std::condition_variable m_wakeSignal;
+
+		std::atomic<uint32_t> m_queuedJobs;
+		std::atomic<bool> m_shuttingDown;
+		bool m_pinThreads;
+
+		// Serializes starting and stopping the workers, m_users counts outstanding acquires
+		std::mutex m_lifecycleLock;
+		uint32_t m_users;
+	};
+
+	class TaskGroup {
+
+	public:
+		TaskGroup();
+		~TaskGroup();
+
+		TaskGroup(const TaskGroup& rhs) = delete;
+		TaskGroup& operator=(const TaskGroup& rhs) = delete;
+
+		// Fork a new task into the group
+		void run(Task task);
+
+		// Join, the calling thread executes pending jobs until every task in the group is finished.
+		// If a task threw, the first exception is rethrown here once the rest have finished
+		void wait();
+
+	private:
+		void captureException(std::exception_ptr exception);
+
+		std::atomic<uint32_t> m_outstanding;
+
+		// First exception a task in the group threw, held until a thread waits on the group
+		std::exception_ptr m_exception;
+		std::mutex m_exceptionLock;
+
+		friend class TaskScheduler;
+	};
+
+	template <typename Body>
+	void TaskScheduler::parallelFor(uint32_t begin, uint32_t end, uint32_t grainSize, const Body& body) {
+
+		if (begin >= end) {
+			return;
+		}
+
+		grainSize = (grainSize > 0) ? grainSize : 1;
+
+		// Not worth forking, or nobody to fork to, so just run it here
+		if (!isRunning() || end - begin <= grainSize) {
+
+			body(begin, end);
+			return;
+		}
+
+		TaskGroup group;
+		for (uint32_t chunk = begin; chunk < end; chunk += grainSize) {
+
+			uint32_t chunkEnd = (end - chunk > grainSize) ? chunk + grainSize : end;
+			group.run([&body, chunk, chunkEnd]() { body(chunk, chunkEnd); });
+		}
+
+		group.wait();
+	}
+
+} // namespace Genetics
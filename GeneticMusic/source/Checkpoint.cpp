@@ -0,0 +1,418 @@
+// Morgen Hyde
+
+#include "Checkpoint.h"
+#include "PackedGenome.h"
+#include "Phrase.h"
+#include "PhraseShape.h"
+
+#include <iostream> // std::cout
+#include <fstream>  // std::ofstream
+#include <sstream>  // std::stringstream
+#include <cstring>  // std::memcpy, std::memcmp
+
+namespace Genetics {
+
+	// Keeps every section and record 8 byte aligned in the mapped file
+	static uint64_t alignTo8(uint64_t bytes) {
+
+		return (bytes + 7) & ~static_cast<uint64_t>(7);
+	}
+
+	static uint32_t getGridPayloadSize(uint32_t measureCount, uint32_t subdivision) {
+
+		return 2 * measureCount * subdivision + measureCount * 4 * sizeof(Chord);
+	}
+
+	uint32_t getCheckpointRecordSize(uint32_t measureCount, uint32_t subdivision) {
+
+		return static_cast<uint32_t>(alignTo8(sizeof(CheckpointPhraseRecord) + getGridPayloadSize(measureCount, subdivision)));
+	}
+
+	static void writeRecordFields(const Phrase* phrase, CheckpointPhraseRecord* fields) {
+
+		std::memset(fields, 0, sizeof(CheckpointPhraseRecord));
+
+		fields->m_fitnessValue = phrase->_fitnessValue;
+		fields->m_phraseID = phrase->_phraseID;
+		fields->m_melodicNotes = phrase->_melodicNotes;
+		fields->m_harmonicNotes = phrase->_harmonicNotes;
+	}
+
+	// Copies the grid's arrays into the payload, the grid may be a different phrase to the one the
+	// record's fields came from
+	static void writeGridPayload(const Phrase* grid, uint32_t measureCount, uint32_t subdivision, char* payload) {
+
+		uint32_t maxNotes = measureCount * subdivision;
+		uint32_t chordCount = measureCount * 4;
+
+		std::memcpy(payload, grid->_melodicData, maxNotes);
+		std::memcpy(payload + maxNotes, grid->_melodicRhythm, maxNotes);
+		std::memcpy(payload + 2 * maxNotes, grid->_harmonicData, chordCount * sizeof(Chord));
+	}
+
+	static void readGridPayload(const char* payload, uint32_t measureCount, uint32_t subdivision, Phrase* phrase) {
+
+		uint32_t maxNotes = measureCount * subdivision;
+		uint32_t chordCount = measureCount * 4;
+
+		std::memcpy(phrase->_melodicData, payload, maxNotes);
+		std::memcpy(phrase->_melodicRhythm, payload + maxNotes, maxNotes);
+		std::memcpy(phrase->_harmonicData, payload + 2 * maxNotes, chordCount * sizeof(Chord));
+	}
+
+	static void readRecordFields(const CheckpointPhraseRecord* fields, Phrase* phrase) {
+
+		phrase->_fitnessValue = fields->m_fitnessValue;
+		phrase->_phraseID = fields->m_phraseID;
+		phrase->_melodicNotes = fields->m_melodicNotes;
+		phrase->_harmonicNotes = fields->m_harmonicNotes;
+	}
+
+	// Always getCheckpointRecordSize bytes. Packed phrases are decoded into gridScratch first, which
+	// needs arrays allocated for the shape
+	static void writeFixedRecord(const Phrase* phrase, uint32_t measureCount, uint32_t subdivision, Phrase& gridScratch, char* record) {
+
+		CheckpointPhraseRecord* fields = reinterpret_cast<CheckpointPhraseRecord*>(record);
+		writeRecordFields(phrase, fields);
+
+		const Phrase* grid = phrase;
+		if (phrase->isPacked()) {
+
+			unpackGenome(phrase->_genome->data(), phrase->_packedNotes, &gridScratch);
+			grid = &gridScratch;
+		}
+
+		uint32_t recordSize = getCheckpointRecordSize(measureCount, subdivision);
+		uint32_t payloadSize = getGridPayloadSize(measureCount, subdivision);
+
+		char* payload = record + sizeof(CheckpointPhraseRecord);
+		writeGridPayload(grid, measureCount, subdivision, payload);
+		std::memset(payload + payloadSize, 0, recordSize - sizeof(CheckpointPhraseRecord) - payloadSize);
+
+		fields->m_packedNotes = CheckpointGridRecord;
+		fields->m_recordSize = recordSize;
+	}
+
+	uint32_t packPhraseRecord(const Phrase* phrase, uint32_t measureCount, uint32_t subdivision, char* record) {
+
+		uint32_t chordCount = measureCount * 4;
+
+		CheckpointPhraseRecord* fields = reinterpret_cast<CheckpointPhraseRecord*>(record);
+		writeRecordFields(phrase, fields);
+
+		char* payload = record + sizeof(CheckpointPhraseRecord);
+
+		uint32_t packedNotes = 0;
+		uint32_t payloadSize = 0;
+		if (phrase->isPacked()) {
+
+			// Already in the record's form, packed populations are written out as they sit
+			fields->m_packedNotes = phrase->_packedNotes;
+			payloadSize = phrase->_genome->_byteCount;
+
+			std::memcpy(payload, phrase->_genome->data(), payloadSize);
+		}
+		else if (packGenome(phrase, payload, packedNotes)) {
+
+			fields->m_packedNotes = packedNotes;
+			payloadSize = getPackedGenomeSize(packedNotes, chordCount);
+		}
+		else {
+
+			// Kept as is, packing would have lost something
+			fields->m_packedNotes = CheckpointGridRecord;
+			payloadSize = getGridPayloadSize(measureCount, subdivision);
+
+			writeGridPayload(phrase, measureCount, subdivision, payload);
+		}
+
+		uint32_t recordSize = static_cast<uint32_t>(alignTo8(sizeof(CheckpointPhraseRecord) + payloadSize));
+		std::memset(payload + payloadSize, 0, recordSize - sizeof(CheckpointPhraseRecord) - payloadSize);
+
+		fields->m_recordSize = recordSize;
+		return recordSize;
+	}
+
+	bool checkPhraseRecord(const char* record, uint64_t available, uint32_t measureCount, uint32_t subdivision) {
+
+		if (available < sizeof(CheckpointPhraseRecord)) {
+			return false;
+		}
+
+		const CheckpointPhraseRecord* fields = reinterpret_cast<const CheckpointPhraseRecord*>(record);
+
+		uint32_t payloadSize = 0;
+		if (fields->m_packedNotes == CheckpointGridRecord) {
+			payloadSize = getGridPayloadSize(measureCount, subdivision);
+		}
+		else if (fields->m_packedNotes <= measureCount * subdivision) {
+			payloadSize = getPackedGenomeSize(fields->m_packedNotes, measureCount * 4);
+		}
+		else {
+			return false;
+		}
+
+		return fields->m_recordSize >= sizeof(CheckpointPhraseRecord) + payloadSize && fields->m_recordSize <= available;
+	}
+
+	void unpackPhraseRecord(const char* record, uint32_t measureCount, uint32_t subdivision, Phrase* phrase) {
+
+		const CheckpointPhraseRecord* fields = reinterpret_cast<const CheckpointPhraseRecord*>(record);
+		readRecordFields(fields, phrase);
+
+		const char* payload = record + sizeof(CheckpointPhraseRecord);
+		if (fields->m_packedNotes != CheckpointGridRecord) {
+
+			unpackGenome(payload, fields->m_packedNotes, phrase);
+			return;
+		}
+
+		readGridPayload(payload, measureCount, subdivision, phrase);
+	}
+
+	static void saveEngine(const std::mt19937* randomEngine, CheckpointEngineState& state) {
+
+		std::memset(&state, 0, sizeof(state));
+		if (!randomEngine) {
+			return;
+		}
+
+		std::stringstream stream;
+		stream << *randomEngine;
+
+		uint32_t word = 0;
+		while (state.m_wordCount < CheckpointEngineWords && stream >> word) {
+			state.m_words[state.m_wordCount++] = word;
+		}
+	}
+
+	bool writeCheckpoint(const std::string& filepath, const std::vector<Phrase*>& population, const CheckpointState& state) {
+
+		std::ofstream checkpointFile(filepath, std::ios::binary);
+		if (!checkpointFile.is_open()) {
+
+			std::cout << "Unable to open checkpoint file " << filepath << std::endl;
+			return false;
+		}
+
+		uint32_t maxRecordSize = getCheckpointRecordSize(state.m_measureCount, state.m_subdivision);
+		uint32_t phraseCount = static_cast<uint32_t>(population.size());
+
+		CheckpointHeader header;
+		std::memset(&header, 0, sizeof(header));
+		std::memcpy(header.m_magic, "GMCP", 4);
+
+		header.m_version = CheckpointFileVersion;
+		header.m_byteOrder = CheckpointByteOrder;
+		header.m_headerSize = sizeof(CheckpointHeader);
+
+		header.m_measureCount = state.m_measureCount;
+		header.m_subdivision = state.m_subdivision;
+		header.m_maxRecordSize = maxRecordSize;
+
+		header.m_phraseCount = phraseCount;
+		header.m_generation = state.m_generation;
+		header.m_nextPhraseID = state.m_nextPhraseID;
+
+		header.m_seed = state.m_seed;
+		header.m_seeded = state.m_seeded ? 1 : 0;
+
+		header.m_engineCount = engine_Count;
+		header.m_fixedRecords = state.m_fixedRecords ? 1 : 0;
+		header.m_engineOffset = alignTo8(sizeof(CheckpointHeader));
+		header.m_phraseOffset = alignTo8(header.m_engineOffset + engine_Count * sizeof(CheckpointEngineState));
+
+		// Record sizes aren't known until they're packed, the index and total size are filled in
+		// once the records are out and the header written again
+		checkpointFile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+		// Zeroes to pad each section out to its offset
+		const char padding[8] = {};
+		checkpointFile.write(padding, header.m_engineOffset - sizeof(header));
+
+		for (uint32_t engine = 0; engine < engine_Count; ++engine) {
+
+			CheckpointEngineState engineState;
+			saveEngine(state.m_engines[engine], engineState);
+
+			checkpointFile.write(reinterpret_cast<const char*>(&engineState), sizeof(engineState));
+		}
+
+		checkpointFile.write(padding, header.m_phraseOffset - (header.m_engineOffset + engine_Count * sizeof(CheckpointEngineState)));
+
+		// Every record is built in one buffer so it goes out in a single write
+		std::vector<char> record(maxRecordSize);
+		std::vector<uint64_t> recordOffsets;
+		recordOffsets.reserve(phraseCount);
+
+		// Packed population members are decoded into here for fixed records
+		Phrase gridScratch;
+		if (state.m_fixedRecords) {
+			gridScratch.allocateArrays(state.m_measureCount, state.m_subdivision);
+		}
+
+		uint64_t offset = header.m_phraseOffset;
+		for (const Phrase* phrase : population) {
+
+			uint32_t recordSize = maxRecordSize;
+			if (state.m_fixedRecords) {
+				writeFixedRecord(phrase, state.m_measureCount, state.m_subdivision, gridScratch, record.data());
+			}
+			else {
+				recordSize = packPhraseRecord(phrase, state.m_measureCount, state.m_subdivision, record.data());
+			}
+			checkpointFile.write(record.data(), recordSize);
+
+			recordOffsets.push_back(offset);
+			offset += recordSize;
+		}
+
+		header.m_indexOffset = offset;
+		header.m_fileSize = header.m_indexOffset + static_cast<uint64_t>(phraseCount) * sizeof(uint64_t);
+
+		checkpointFile.write(reinterpret_cast<const char*>(recordOffsets.data()), recordOffsets.size() * sizeof(uint64_t));
+
+		checkpointFile.seekp(0);
+		checkpointFile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+		if (!checkpointFile.good()) {
+
+			std::cout << "Failed writing checkpoint file " << filepath << std::endl;
+			return false;
+		}
+
+		return true;
+	}
+
+	CheckpointReader::CheckpointReader() {
+	}
+
+	bool CheckpointReader::open(const std::string& filepath) {
+
+		if (!m_file.open(filepath)) {
+			return false;
+		}
+
+		// The header has to agree with the file, packed files also have every record checked against the index
+		const CheckpointHeader& header = getHeader();
+
+		bool valid = m_file.size() >= sizeof(CheckpointHeader) && std::memcmp(header.m_magic, "GMCP", 4) == 0;
+		if (!valid) {
+			std::cout << filepath << " is not a checkpoint file" << std::endl;
+		}
+		else if (header.m_byteOrder != CheckpointByteOrder) {
+
+			std::cout << filepath << " was written on a machine with a different byte order" << std::endl;
+			valid = false;
+		}
+		else if (header.m_version != CheckpointFileVersion || header.m_headerSize != sizeof(CheckpointHeader)) {
+
+			std::cout << filepath << " is checkpoint version " << header.m_version << ", expected " << CheckpointFileVersion << std::endl;
+			valid = false;
+		}
+		else if (!isSupportedShape(header.m_measureCount, header.m_subdivision)) {
+
+			std::cout << filepath << " holds " << header.m_measureCount << " measure phrases of " << header.m_subdivision
+			          << " slots, which aren't a supported shape" << std::endl;
+			valid = false;
+		}
+		else if (header.m_maxRecordSize != getCheckpointRecordSize(header.m_measureCount, header.m_subdivision) ||
+		         header.m_fileSize != m_file.size() ||
+		         header.m_indexOffset + static_cast<uint64_t>(header.m_phraseCount) * sizeof(uint64_t) != m_file.size() ||
+		         header.m_indexOffset < header.m_phraseOffset || (header.m_indexOffset & 7) != 0 ||
+		         header.m_engineOffset + header.m_engineCount * sizeof(CheckpointEngineState) > header.m_phraseOffset) {
+
+			std::cout << filepath << " is truncated or corrupt" << std::endl;
+			valid = false;
+		}
+		else if (header.m_fixedRecords != 0) {
+
+			// Fixed records are found by arithmetic and always copied as grids, so the sizes adding
+			// up is all there is to check
+			valid = (header.m_phraseOffset & 7) == 0 &&
+			        header.m_indexOffset == header.m_phraseOffset + static_cast<uint64_t>(header.m_phraseCount) * header.m_maxRecordSize;
+
+			if (!valid) {
+				std::cout << filepath << " is truncated or corrupt" << std::endl;
+			}
+		}
+		else {
+
+			// Every record has to sit inside the record section, so restoring never needs to check
+			const uint64_t* recordOffsets = getRecordOffsets();
+			for (uint32_t i = 0; i < header.m_phraseCount && valid; ++i) {
+
+				uint64_t offset = recordOffsets[i];
+				valid = offset >= header.m_phraseOffset && offset < header.m_indexOffset && (offset & 7) == 0 &&
+				        checkPhraseRecord(m_file.data() + offset, header.m_indexOffset - offset, header.m_measureCount, header.m_subdivision);
+			}
+
+			if (!valid) {
+				std::cout << filepath << " has a corrupt phrase record" << std::endl;
+			}
+		}
+
+		if (!valid) {
+			m_file.close();
+		}
+
+		return valid;
+	}
+
+	uint64_t CheckpointReader::getRecordOffset(uint32_t index) const {
+
+		const CheckpointHeader& header = getHeader();
+		if (header.m_fixedRecords != 0) {
+			return header.m_phraseOffset + static_cast<uint64_t>(index) * header.m_maxRecordSize;
+		}
+
+		return getRecordOffsets()[index];
+	}
+
+	void CheckpointReader::restorePhrase(uint32_t index, Phrase* phrase) const {
+
+		const CheckpointHeader& header = getHeader();
+		const char* record = m_file.data() + getRecordOffset(index);
+
+		if (header.m_fixedRecords == 0) {
+
+			unpackPhraseRecord(record, header.m_measureCount, header.m_subdivision, phrase);
+			return;
+		}
+
+		// Nothing in a fixed record was checked on open, so it's read as a grid whatever it claims
+		readRecordFields(reinterpret_cast<const CheckpointPhraseRecord*>(record), phrase);
+		readGridPayload(record + sizeof(CheckpointPhraseRecord), header.m_measureCount, header.m_subdivision, phrase);
+	}
+
+	bool CheckpointReader::restoreEngine(CheckpointEngine engine, std::mt19937& randomEngine) const {
+
+		const CheckpointHeader& header = getHeader();
+		if (static_cast<uint32_t>(engine) >= header.m_engineCount) {
+			return false;
+		}
+
+		const CheckpointEngineState* engineStates = reinterpret_cast<const CheckpointEngineState*>(m_file.data() + header.m_engineOffset);
+		const CheckpointEngineState& state = engineStates[engine];
+
+		if (state.m_wordCount == 0 || state.m_wordCount > CheckpointEngineWords) {
+			return false;
+		}
+
+		std::stringstream stream;
+		for (uint32_t i = 0; i < state.m_wordCount; ++i) {
+			stream << state.m_words[i] << ' ';
+		}
+
+		// Read into a copy so a state from another standard library can't leave the engine half set
+		std::mt19937 restored;
+		stream >> restored;
+		if (stream.fail()) {
+			return false;
+		}
+
+		randomEngine = restored;
+		return true;
+	}
+
+} // namespace Genetics
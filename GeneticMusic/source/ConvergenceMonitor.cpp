@@ -0,0 +1,155 @@
+// Morgen Hyde
+
+#include "ConvergenceMonitor.h"
+#include "GADefaultConfig.h"
+#include "Phrase.h"
+#include "PackedGenome.h"
+
+#include "Utility/PhraseHash.h"
+
+#include <algorithm> // std::sort, std::unique
+
+namespace Genetics {
+
+	const char* getConvergenceReasonName(ConvergenceReason reason) {
+
+		switch (reason) {
+
+			case conv_FitnessPlateau:      return "Fitness plateau";
+			case conv_DiversityCollapse:   return "Diversity collapse";
+			case conv_DuplicateSaturation: return "Duplicate saturation";
+			default:                       return "Not converged";
+		}
+	}
+
+	ConvergenceMonitor::ConvergenceMonitor()
+		: m_criteria(DefaultConvergenceCriteria) {
+
+		reset();
+	}
+
+	ConvergenceMonitor::~ConvergenceMonitor() {
+	}
+
+	void ConvergenceMonitor::reset() {
+
+		m_latest = { 0, 0.0f, 0.0f, 1.0f, 0.0f, 0, 0 };
+
+		m_bestReference = 0.0f;
+		m_meanReference = 0.0f;
+		m_hasReference = false;
+	}
+
+	void ConvergenceMonitor::setCriteria(const ConvergenceCriteria& criteria) {
+
+		m_criteria = criteria;
+	}
+
+	ConvergenceReason ConvergenceMonitor::update(const std::vector<Phrase*>& population) {
+
+		if (population.empty()) {
+			return conv_None;
+		}
+
+		// Fitness summary, don't rely on the population being sorted (steady state isn't mid-run)
+		const Phrase* best = population.front();
+		float fitnessSum = 0.0f;
+		for (const Phrase* phrase : population) {
+
+			fitnessSum += phrase->_fitnessValue;
+			if (phrase->_fitnessValue > best->_fitnessValue) {
+				best = phrase;
+			}
+		}
+
+		++m_latest.m_generation;
+		m_latest.m_bestFitness = best->_fitnessValue;
+		m_latest.m_meanFitness = fitnessSum / static_cast<float>(population.size());
+
+		// A generation counts as progress if either the best or the mean moved past the tolerance
+		bool improved = !m_hasReference ||
+			m_latest.m_bestFitness > m_bestReference + m_criteria.m_plateauTolerance ||
+			m_latest.m_meanFitness > m_meanReference + m_criteria.m_plateauTolerance;
+
+		if (improved) {
+
+			m_bestReference = m_hasReference ? std::max(m_bestReference, m_latest.m_bestFitness) : m_latest.m_bestFitness;
+			m_meanReference = m_hasReference ? std::max(m_meanReference, m_latest.m_meanFitness) : m_latest.m_meanFitness;
+			m_hasReference = true;
+
+			m_latest.m_stalledGenerations = 0;
+		}
+		else {
+			++m_latest.m_stalledGenerations;
+		}
+
+		m_latest.m_diversity = measureDiversity(population, best);
+		m_latest.m_duplicateRatio = measureDuplicateRatio(population);
+
+		if (!m_criteria.m_enabled || m_latest.m_generation < m_criteria.m_minGenerations) {
+			return conv_None;
+		}
+
+		if (m_criteria.m_plateauGenerations > 0 && m_latest.m_stalledGenerations >= m_criteria.m_plateauGenerations) {
+			return conv_FitnessPlateau;
+		}
+		if (m_latest.m_diversity < m_criteria.m_minDiversity) {
+			return conv_DiversityCollapse;
+		}
+		if (m_latest.m_duplicateRatio > m_criteria.m_maxDuplicateRatio) {
+			return conv_DuplicateSaturation;
+		}
+
+		return conv_None;
+	}
+
+	float ConvergenceMonitor::measureDiversity(const std::vector<Phrase*>& population, const Phrase* best) {
+
+		// Mean hamming distance to the best phrase, O(N * L) instead of comparing every pair
+		flattenMelody(getGridView(best, m_gridScratch), m_bestMelody);
+
+		uint32_t slotCount = static_cast<uint32_t>(m_bestMelody.size());
+		if (slotCount == 0 || population.size() < 2) {
+			return 0.0f;
+		}
+
+		uint64_t differingSlots = 0;
+		for (const Phrase* phrase : population) {
+
+			flattenMelody(getGridView(phrase, m_gridScratch), m_memberMelody);
+			for (uint32_t slot = 0; slot < slotCount; ++slot) {
+				differingSlots += (m_memberMelody[slot] != m_bestMelody[slot]);
+			}
+		}
+
+		// The best phrase is compared against itself, leave it out of the average
+		return static_cast<float>(differingSlots) / static_cast<float>(slotCount * (population.size() - 1));
+	}
+
+	float ConvergenceMonitor::measureDuplicateRatio(const std::vector<Phrase*>& population) {
+
+		m_genomeHashes.clear();
+		for (const Phrase* phrase : population) {
+			m_genomeHashes.push_back(hashPhraseGenome(getGridView(phrase, m_gridScratch)));
+		}
+
+		std::sort(m_genomeHashes.begin(), m_genomeHashes.end());
+		size_t distinct = std::unique(m_genomeHashes.begin(), m_genomeHashes.end()) - m_genomeHashes.begin();
+		m_latest.m_uniqueGenomes = static_cast<uint32_t>(distinct);
+
+		return 1.0f - static_cast<float>(distinct) / static_cast<float>(population.size());
+	}
+
+	void ConvergenceMonitor::flattenMelody(const Phrase* phrase, std::vector<int16_t>& output) const {
+
+		uint32_t arrayLen = phrase->_numMeasures * phrase->_smallestSubdivision;
+		output.assign(arrayLen, -1);
+
+		for (uint32_t note = 0; note < arrayLen && phrase->_melodicRhythm[note] > 0; note += phrase->_melodicRhythm[note]) {
+
+			// Pitch and length both have to match for the slot to count as the same
+			output[note] = static_cast<int16_t>((static_cast<uint8_t>(phrase->_melodicData[note]) << 8) | static_cast<uint8_t>(phrase->_melodicRhythm[note]));
+		}
+	}
+
+} // namespace Genetics
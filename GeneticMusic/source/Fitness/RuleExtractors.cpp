@@ -1,153 +1,143 @@
-#include "Fitness/RuleExtractors.h"
-#include "Fitness/RuleBuilder.h"
-
-#include "Phrase.h"
-#include <iostream>
-
-namespace Genetics {
-
-
-	PitchExtractor::PitchExtractor(const RuleList<PitchRule> rules)
-		: m_pitchRules(rules), m_dataBuffer(new char[Phrase::_numMeasures * Phrase::_smallestSubdivision]) {
-
-	}
-
-	PitchExtractor::~PitchExtractor() {
-
-		delete[] m_dataBuffer;
-	}
-
-	float PitchExtractor::process(Phrase* subject) const {
-
-		float total = 0.0f;
-		std::memset(m_dataBuffer, 0, sizeof(char) * Phrase::_numMeasures * Phrase::_smallestSubdivision);
-
-		uint32_t note = 0;
-		for (uint32_t i = 0; i < subject->_melodicNotes; ++i) {
-
-			m_dataBuffer[i] = subject->_melodicData[note];
-			note += subject->_melodicRhythm[note];
-		}
-
-		return m_pitchRules.evaluateAll(m_dataBuffer, subject->_melodicNotes);
-	}
-
-
-
-	RhythmExtractor::RhythmExtractor(const RuleList<RhythmRule> rules)
-		: m_rhythmRules(rules), m_dataBuffer(new char[Phrase::_numMeasures * Phrase::_smallestSubdivision]) {
-
-	}
-
-	RhythmExtractor::~RhythmExtractor() {
-
-		delete[] m_dataBuffer;
-	}
-
-	float RhythmExtractor::process(Phrase* subject) const {
-
-		float total = 0.0f;
-		std::memset(m_dataBuffer, 0, sizeof(char) * Phrase::_numMeasures * Phrase::_smallestSubdivision);
-
-		uint32_t note = 0;
-		for (uint32_t i = 0; i < subject->_melodicNotes; ++i) {
-
-			// Build packed array of note lengths
-			m_dataBuffer[i] = subject->_melodicRhythm[note];
-			note += subject->_melodicRhythm[note];
-		}
-
-		// Run every function for rhythm and return the values
-		return m_rhythmRules.evaluateAll(m_dataBuffer, subject->_melodicNotes);
-	}
-
-
-
-	IntervalExtractor::IntervalExtractor(const RuleList<IntervalRule> rules)
-		: m_intervalRules(rules), m_dataBuffer(new uint8_t[Phrase::_numMeasures * Phrase::_smallestSubdivision]) {
-
-	}
-
-	IntervalExtractor::~IntervalExtractor() {
-
-		delete[] m_dataBuffer;
-	}
-
-	float IntervalExtractor::process(Phrase* subject) const {
-
-		float total = 0.0f;
-		std::memset(m_dataBuffer, 0, sizeof(uint8_t) * Phrase::_numMeasures * Phrase::_smallestSubdivision);
-
-		uint32_t note = subject->_melodicRhythm[0];
-		char lastPitch = subject->_melodicData[0];
-		for (uint32_t i = 1; i < subject->_melodicNotes; ++i) {
-
-			// Calculate intervals between each pair of notes
-			m_dataBuffer[i - 1] = std::abs(lastPitch - subject->_melodicData[note]);
-			lastPitch = subject->_melodicData[note];
-			note += subject->_melodicRhythm[note];
-		}
-
-		return m_intervalRules.evaluateAll(m_dataBuffer, subject->_melodicNotes - 1);
-	}
-
-
-
-	MeasureExtractor::MeasureExtractor(const RuleList<MeasureRule> rules)
-		: m_measureRules(rules), m_dataBuffer(new Measure[Phrase::_numMeasures]) {
-	}
-
-	MeasureExtractor::~MeasureExtractor() {
-
-		delete[] m_dataBuffer;
-	}
-
-	float MeasureExtractor::process(Phrase* subject) const {
-
-		
-
-		return 0.0f;
-	}
-
-	ChordExtractor::ChordExtractor(const RuleList<ChordRule> rules)
-		: m_chordRules(rules), m_dataBuffer(new uint8_t[Phrase::_numMeasures * Phrase::_smallestSubdivision]) {
-	}
-
-	ChordExtractor::~ChordExtractor() {
-		
-		delete[] m_dataBuffer;
-	}
-
-	float ChordExtractor::process(Phrase* subject) const {
-
-		float total = 0.0f;
-		std::memset(m_dataBuffer, 0, sizeof(uint8_t) * Phrase::_numMeasures * Phrase::_smallestSubdivision);
-
-		uint32_t noteIdx = 0;
-
-		uint8_t previousPitch = 0, currentRoot = 0;
-		for (uint32_t outputIdx = 0; outputIdx < subject->_melodicNotes; ++outputIdx) {
-
-			// Get the pitch of the next note
-			uint8_t pitch = subject->_melodicData[noteIdx];
-
-			// If the pitch is zero use the previous one
-			if (pitch == 0) { pitch = previousPitch; }
-
-			// Get the current root note
-			if (noteIdx % 4 == 0) {
-				const Chord& currentChord = subject->_harmonicData[noteIdx / ChordRhythm];
-				currentRoot = calculateRootNote(pitch, currentChord);
-			}
-
-			// Determine interval between the root and current pitch
-			m_dataBuffer[outputIdx] = pitch - currentRoot;
-			
-			// Determine index shift amounts
-			noteIdx += subject->_melodicRhythm[noteIdx];
-		}
-
-		return m_chordRules.evaluateAll(m_dataBuffer, subject->_harmonicNotes);
-	}
-
+#include "Fitness/RuleExtractors.h"
+#include "Fitness/RuleBuilder.h"
+
+#include "Phrase.h"
+#include "NoteEventList.h"
+#include "Utility/Profiler.h"
+#include <iostream>
+#include <vector>
+
+namespace Genetics {
+
+	uint8_t* ExtractorBase::acquireScratchBytes(uint32_t byteCount) {
+
+		// One buffer per thread, only grows so steady state evaluation never allocates
+		thread_local std::vector<uint8_t> scratchBuffer;
+		if (scratchBuffer.size() < byteCount) {
+			scratchBuffer.resize(byteCount);
+		}
+
+		std::memset(scratchBuffer.data(), 0, byteCount);
+		return scratchBuffer.data();
+	}
+
+	PitchExtractor::PitchExtractor(const RuleList<PitchRule> rules)
+		: m_pitchRules(rules) {
+
+	}
+
+	PitchExtractor::~PitchExtractor() {
+
+	}
+
+	float PitchExtractor::process(Phrase* subject, const NoteEventList& notes) const {
+
+		GA_PROFILE_SCOPE("PitchExtractor");
+
+		// Already packed, nothing to build
+		return m_pitchRules.evaluateAll(notes.pitches(), notes.size());
+	}
+
+
+
+	RhythmExtractor::RhythmExtractor(const RuleList<RhythmRule> rules)
+		: m_rhythmRules(rules) {
+
+	}
+
+	RhythmExtractor::~RhythmExtractor() {
+
+	}
+
+	float RhythmExtractor::process(Phrase* subject, const NoteEventList& notes) const {
+
+		GA_PROFILE_SCOPE("RhythmExtractor");
+
+		// Run every function for rhythm and return the values
+		return m_rhythmRules.evaluateAll(notes.durations(), notes.size());
+	}
+
+
+
+	IntervalExtractor::IntervalExtractor(const RuleList<IntervalRule> rules)
+		: m_intervalRules(rules) {
+
+	}
+
+	IntervalExtractor::~IntervalExtractor() {
+
+	}
+
+	float IntervalExtractor::process(Phrase* subject, const NoteEventList& notes) const {
+
+		GA_PROFILE_SCOPE("IntervalExtractor");
+		uint8_t* dataBuffer = acquireScratch<uint8_t>(subject->_numMeasures * subject->_smallestSubdivision);
+
+		const char* pitches = notes.pitches();
+		for (uint32_t i = 1; i < notes.size(); ++i) {
+
+			// Calculate intervals between each pair of notes
+			dataBuffer[i - 1] = std::abs(pitches[i - 1] - pitches[i]);
+		}
+
+		return m_intervalRules.evaluateAll(dataBuffer, notes.size() - 1);
+	}
+
+
+
+	MeasureExtractor::MeasureExtractor(const RuleList<MeasureRule> rules)
+		: m_measureRules(rules) {
+	}
+
+	MeasureExtractor::~MeasureExtractor() {
+
+	}
+
+	float MeasureExtractor::process(Phrase* subject, const NoteEventList& notes) const {
+
+		GA_PROFILE_SCOPE("MeasureExtractor");
+		
+
+		return 0.0f;
+	}
+
+	ChordExtractor::ChordExtractor(const RuleList<ChordRule> rules)
+		: m_chordRules(rules) {
+	}
+
+	ChordExtractor::~ChordExtractor() {
+		
+	}
+
+	float ChordExtractor::process(Phrase* subject, const NoteEventList& notes) const {
+
+		GA_PROFILE_SCOPE("ChordExtractor");
+		uint8_t* dataBuffer = acquireScratch<uint8_t>(subject->_numMeasures * subject->_smallestSubdivision);
+
+		const char* pitches = notes.pitches();
+		const uint16_t* onsets = notes.onsets();
+
+		uint8_t previousPitch = 0, currentRoot = 0;
+		for (uint32_t outputIdx = 0; outputIdx < notes.size(); ++outputIdx) {
+
+			// Get the pitch of the next note
+			uint8_t pitch = pitches[outputIdx];
+
+			// If the pitch is zero use the previous one
+			if (pitch == 0) { pitch = previousPitch; }
+
+			// Get the current root note
+			uint32_t noteIdx = onsets[outputIdx];
+			if (noteIdx % 4 == 0) {
+				const Chord& currentChord = subject->_harmonicData[noteIdx / ChordRhythm];
+				currentRoot = calculateRootNote(pitch, currentChord);
+			}
+
+			// Determine interval between the root and current pitch
+			dataBuffer[outputIdx] = pitch - currentRoot;
+		}
+
+		return m_chordRules.evaluateAll(dataBuffer, subject->_harmonicNotes);
+	}
+
 } // namespace Genetics
\ No newline at end of file
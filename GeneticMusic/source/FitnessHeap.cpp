@@ -0,0 +1,104 @@
+// Morgen Hyde
+
+#include "FitnessHeap.h"
+#include "Phrase.h"
+
+#include <utility> // std::swap
+
+namespace Genetics {
+
+	FitnessHeap::FitnessHeap() {
+	}
+
+	FitnessHeap::~FitnessHeap() {
+	}
+
+	void FitnessHeap::build(const std::vector<Phrase*>& population) {
+
+		uint32_t count = static_cast<uint32_t>(population.size());
+
+		m_nodes.resize(count);
+		m_positions.resize(count);
+
+		for (uint32_t slot = 0; slot < count; ++slot) {
+
+			m_nodes[slot] = { population[slot]->_fitnessValue, slot };
+			m_positions[slot] = slot;
+		}
+
+		// Heapify bottom up, every parent from the last one back to the root
+		for (uint32_t i = count / 2; i-- > 0;) {
+			siftDown(i);
+		}
+	}
+
+	void FitnessHeap::clear() {
+
+		m_nodes.clear();
+		m_positions.clear();
+	}
+
+	void FitnessHeap::update(uint32_t slot, float fitness) {
+
+		uint32_t heapIndex = m_positions[slot];
+		float oldFitness = m_nodes[heapIndex].m_fitness;
+		m_nodes[heapIndex].m_fitness = fitness;
+
+		// Only one direction can be violated depending on how the key moved
+		if (fitness < oldFitness) {
+			siftUp(heapIndex);
+		}
+		else {
+			siftDown(heapIndex);
+		}
+	}
+
+	void FitnessHeap::siftUp(uint32_t heapIndex) {
+
+		while (heapIndex > 0) {
+
+			uint32_t parent = (heapIndex - 1) / 2;
+			if (m_nodes[parent].m_fitness <= m_nodes[heapIndex].m_fitness) {
+				break;
+			}
+
+			swapNodes(parent, heapIndex);
+			heapIndex = parent;
+		}
+	}
+
+	void FitnessHeap::siftDown(uint32_t heapIndex) {
+
+		uint32_t count = size();
+		while (true) {
+
+			uint32_t smallest = heapIndex;
+			uint32_t left = 2 * heapIndex + 1;
+			uint32_t right = left + 1;
+
+			if (left < count && m_nodes[left].m_fitness < m_nodes[smallest].m_fitness) {
+				smallest = left;
+			}
+			if (right < count && m_nodes[right].m_fitness < m_nodes[smallest].m_fitness) {
+				smallest = right;
+			}
+
+			if (smallest == heapIndex) {
+				break;
+			}
+
+			swapNodes(smallest, heapIndex);
+			heapIndex = smallest;
+		}
+	}
+
+	void FitnessHeap::swapNodes(uint32_t lhs, uint32_t rhs) {
+
+		std::swap(m_nodes[lhs], m_nodes[rhs]);
+
+		// Keep the reverse lookup in sync with the moved nodes
+		m_positions[m_nodes[lhs].m_slot] = lhs;
+		m_positions[m_nodes[rhs].m_slot] = rhs;
+	}
+
+} // namespace Genetics
@@ -1,233 +1,802 @@
-
-#include "GAController.h"
-#include "GADefaultConfig.h"
-
-#include "AudioPlayback/SynthesizerBase.h"
-#include "AudioPlayback/PianoSynth.h"
-#include "FIleIO/MIDIFiles.h"
-
-
-#ifdef _DEBUG
-	#include "Utility/Diagnostics.h"
-#endif
-
-namespace Genetics {
-
-	GeneticAlgorithmController::GeneticAlgorithmController()
-		: m_populationGen(DefaultPopulationSize, { DefaultMeasureCount, DefaultSubdivision }),
-		  m_phrasePool(nullptr), m_activePhrase(nullptr), m_iterationsPerStep(DefaultGenCount),
-		  m_totalGenerations(0), m_activeSynth(nullptr), m_populationSize(DefaultPopulationSize),
-		  m_fitness() {
-
-		m_phrasePool = m_populationGen.GeneratePopulation();
-		m_activePhrase = m_phrasePool->GetPhrases().front();
-
-		//m_activeSynth = new SynthesizerBase(48000, DefaultMeter);
-		m_activeSynth = new PianoSynth(48000, DefaultMeter);
-	}
-
-	GeneticAlgorithmController::~GeneticAlgorithmController() {
-	}
-
-	void GeneticAlgorithmController::initializeAlgorithm() {
-
-		m_audioEngine.Initialize();
-		m_audioEngine.SetSynthesizer(m_activeSynth);
-
-		m_fitness.Assess(m_phrasePool);
-		m_mutation.InitMutationPool();
-	}
-
-	void GeneticAlgorithmController::run() {
-
-		int16_t genCount = 0;
-		uint32_t maxPopulation = m_populationGen.GetPopulationSize();
-		while (genCount++ < m_iterationsPerStep) {
-
-			// Check if we've generated enough children to fill a generation
-			while (m_phrasePool->GetNumChildren() < maxPopulation) {
-
-#ifdef _DEBUG
-				std::cout << "Starting selection step..." << std::endl;
-#endif
-				// Select a new set of parents
-				BreedingPair selected = m_selection.SelectPair(m_phrasePool);
-
-#ifdef _DEBUG
-				std::cout << "Starting breeding step..." << std::endl;
-#endif
-				// Breed the phrases together and produce an output (auto added as child in pool)
-				m_breeding.Breed(selected, m_phrasePool);
-
-#ifdef _DEBUG
-				GA_Error errorCode = validateNoteCount(m_phrasePool->GetChildren().back());
-				printErrorMessage(errorCode);
-
-				errorCode = validateNoteLengths(m_phrasePool->GetChildren().back());
-				printErrorMessage(errorCode);
-
-				errorCode = validateRestOccurances(m_phrasePool->GetChildren().back());
-				printErrorMessage(errorCode);
-
-				std::cout << "Starting mutation step..." << std::endl;
-#endif
-				// Apply a mutation to the child to introduce some variety
-				m_mutation.Mutate(m_phrasePool->GetChildren().back());
-
-#ifdef _DEBUG
-				errorCode = validateNoteCount(m_phrasePool->GetChildren().back());
-				printErrorMessage(errorCode);
-
-				errorCode = validateNoteLengths(m_phrasePool->GetChildren().back());
-				printErrorMessage(errorCode);
-
-				std::cout << "Starting assessment step..." << std::endl;
-#endif 
-				// Evaluate the fitness of the new phrase
-				m_fitness.Assess(m_phrasePool->GetChildren().back());
-			}
-
-			// Once we have enough children, prune the population back 
-			m_phrasePool->MergeChildrenToPopulation<PruningType>();
-
-			// Increment total generations counter
-			++m_totalGenerations;
-		}
-
-		m_activePhrase = m_phrasePool->GetPhrases()[0];
-	}
-
-	void GeneticAlgorithmController::updateAudioEngine() {
-		
-		m_audioEngine.Update();
-	}
-
-	void GeneticAlgorithmController::shutdownAlgorithm() {
-
-		m_audioEngine.StopAll();
-		m_audioEngine.Shutdown();
-	}
-
-
-	void GeneticAlgorithmController::setMeterInfoStruct(const MeterInfo& meterData) {
-
-		
-	}
-
-	void GeneticAlgorithmController::setPhrasePoolSize(uint32_t populationSize) {
-
-		m_populationSize = populationSize;
-	}
-
-
-	void GeneticAlgorithmController::setIterationCount(uint32_t iterations) {
-
-		m_iterationsPerStep = iterations;
-	}
-
-	void GeneticAlgorithmController::clearPhrasePool() {
-
-		// Delete the current phrase pool
-		delete m_phrasePool;
-		Phrase::_phraseCount = 0; // Start ID stack at 0 again
-
-		// Reset the allocator for the population
-		m_populationGen.resetAllocator(m_populationSize);
-
-		// Regenerate a new base population
-		m_phrasePool = m_populationGen.GeneratePopulation();
-
-#ifdef _DEBUG
-		const std::vector<Phrase*>& phraseVec = m_phrasePool->GetPhrases();
-		for (Phrase* currPhrase : phraseVec) {
-
-			GA_Error errorCode = validateRestOccurances(currPhrase);
-			printErrorMessage(errorCode);
-		}
-#endif
-
-		// Rescore the fresh pool for a starting point
-		m_fitness.Assess(m_phrasePool);
-
-		// Set active to the current front of the phrase list
-		m_activePhrase = m_phrasePool->GetPhrases()[0];
-	}
-
-	void GeneticAlgorithmController::setActivePhrase(uint32_t phraseID) {
-
-		const PhraseVec& phrases = m_phrasePool->GetPhrases();
-		for (Phrase* phrase : phrases) {
-			
-			if (phrase->_phraseID == phraseID) {
-				m_activePhrase = phrase;
-				return;
-			}
-		}
-	}
-
-
-	uint32_t GeneticAlgorithmController::getActivePhraseID() const {
-
-		return m_activePhrase->_phraseID;
-	}
-
-	Phrase* GeneticAlgorithmController::getActivePhrase() const {
-
-		return m_activePhrase;
-	}
-
-
-	const std::vector<Phrase*>& GeneticAlgorithmController::getPhraseList() const {
-
-		return m_phrasePool->GetPhrases();
-	}
-
-
-	void GeneticAlgorithmController::exportPhraseToMIDI(const std::string& filepath, Phrase* phrase) const {
-
-		MIDIHandler midiOutput;
-		phrase = (phrase == nullptr) ? m_activePhrase : phrase;
-
-		midiOutput.writeToMIDI(m_activePhrase, filepath);
-	}
-
-	void GeneticAlgorithmController::importMIDIToPhrase(const std::string& filepath, Phrase* phrase) {
-
-		MIDIHandler midiInput;
-
-		phrase = (phrase == nullptr) ? m_activePhrase : phrase;
-		
-		std::memset(phrase->_melodicData, 0, phrase->_smallestSubdivision * phrase->_numMeasures);
-		std::memset(phrase->_melodicRhythm, 0, phrase->_smallestSubdivision * phrase->_numMeasures);
-		phrase->_melodicNotes = 0;
-
-		midiInput.readFromMIDI(m_activePhrase, filepath);
-	}
-
-
-	void GeneticAlgorithmController::playCurrentlySelectedPhrase() {
-	
-		m_audioEngine.Play(m_activePhrase);
-	}
-
-	void GeneticAlgorithmController::pauseCurrentlySelectedPhrase() {
-
-	}
-
-	void GeneticAlgorithmController::stopCurrentlySelectedPhrase() {
-
-		m_audioEngine.StopAll();
-	}
-
-
-	void GeneticAlgorithmController::setPlaybackSynthesizer(SynthesizerBase* synth) {
-
-		if (m_activeSynth) {
-			delete m_activeSynth;
-		}
-
-		m_activeSynth = synth;
-	}
-
-
+
+#include "GAController.h"
+#include "GADefaultConfig.h"
+
+#include "AudioPlayback/SynthesizerBase.h"
+#include "AudioPlayback/PianoSynth.h"
+#include "FIleIO/MIDIFiles.h"
+#include "Utility/TaskScheduler.h"
+#include "Utility/Profiler.h"
+#include "Utility/Logger.h"
+
+#include <iostream>  // std::cout
+#include <chrono>    // std::chrono::steady_clock
+#include <algorithm> // std::min, std::max
+
+
+#ifdef _DEBUG
+	#include "Utility/Diagnostics.h"
+#endif
+
+namespace Genetics {
+
+	GeneticAlgorithmController::GeneticAlgorithmController()
+		: m_populationGen(DefaultPopulationSize, { DefaultMeasureCount, DefaultSubdivision }),
+		  m_phrasePool(nullptr), m_activePhrase(nullptr), m_hallOfFame(DefaultHallOfFameSize),
+		  m_stopReason(conv_None), m_timeBudgetMs(DefaultTimeBudgetMs), m_childCostEstimate(0.0),
+		  m_telemetry(DefaultTelemetryCapacity), m_stageTimes(), m_childrenThisGeneration(0), m_seed(0), m_seeded(false), m_iterationsPerStep(DefaultGenCount),
+		  m_totalGenerations(0), m_audioEnabled(false), m_activeSynth(nullptr), m_populationSize(DefaultPopulationSize), m_steadyState(DefaultSteadyState),
+		  m_packedPopulation(DefaultPackedPopulation), m_fixedCheckpointRecords(DefaultFixedCheckpointRecords), m_workerCount(DefaultWorkerCount), m_pinWorkers(DefaultPinWorkers), m_holdsScheduler(true), m_fitness() {
+
+		// Workers need to be up before the first population is generated. Shared with any other
+		// controller that's alive, only the first one starts them
+		TaskScheduler::getScheduler().acquire(m_workerCount, m_pinWorkers);
+
+		// Only used once a model has been trained or loaded
+		m_populationGen.SetMarkovModel(&m_markovModel);
+		m_mutation.SetMarkovModel(&m_markovModel);
+
+		m_phrasePool = m_populationGen.GeneratePopulation();
+		m_activePhrase = m_phrasePool->GetPhrases().front();
+
+		//m_activeSynth = new SynthesizerBase(48000, DefaultMeter);
+		m_activeSynth = new PianoSynth(48000, DefaultMeter);
+	}
+
+	GeneticAlgorithmController::~GeneticAlgorithmController() {
+
+		if (m_holdsScheduler) {
+			TaskScheduler::getScheduler().release();
+		}
+	}
+
+	void GeneticAlgorithmController::initializeAlgorithm(bool enableAudio) {
+
+		m_audioEnabled = enableAudio;
+		if (m_audioEnabled) {
+
+			m_audioEngine.Initialize();
+			m_audioEngine.SetSynthesizer(m_activeSynth);
+		}
+
+		// Scoring reads the grids, settling packs the population again afterwards
+		if (m_packedPopulation) {
+			m_phrasePool->UnpackPopulation();
+		}
+
+		m_fitness.Assess(m_phrasePool);
+		m_hallOfFame.offerAll(m_phrasePool->GetPhrases());
+		m_convergence.reset();
+		settlePopulation();
+
+		m_mutation.InitMutationPool();
+
+		// Breeding is operator 0 for the integrity checks, each mutation follows in pool order
+		std::vector<const char*> operatorNames = { "Breeding" };
+		for (unsigned i = 0; i < m_mutation.GetMutationCount(); ++i) {
+			operatorNames.push_back(m_mutation.GetMutationName(i));
+		}
+		m_integrity.setOperators(operatorNames);
+	}
+
+	void GeneticAlgorithmController::run() {
+
+		GA_PROFILE_SCOPE("Run");
+		m_stopReason = conv_None;
+
+		// Don't count time spent idle between runs against the first generation
+		m_generationStart = std::chrono::steady_clock::now();
+
+		// Picks up the active phrase and anything else unpacked since the last run
+		if (m_packedPopulation) {
+
+			GA_PROFILE_SCOPE("Packing");
+			StageTimer timer(m_stageTimes[stage_Packing]);
+			m_phrasePool->PackPopulation();
+		}
+
+		if (m_timeBudgetMs > 0) {
+			runForTimeBudget();
+		}
+		else {
+
+			uint32_t genCount = 0;
+			while (genCount++ < m_iterationsPerStep) {
+
+				if (m_steadyState) {
+					runSteadyState();
+				}
+				else {
+					runGeneration();
+				}
+
+				if (finishGeneration()) {
+					break;
+				}
+			}
+		}
+
+		// Steady state leaves the population in replacement order, put the best phrase up front
+		if (m_steadyState) {
+			m_phrasePool->SortPopulation();
+		}
+
+		settlePopulation();
+	}
+
+	bool GeneticAlgorithmController::finishGeneration() {
+
+		// Increment total generations counter
+		++m_totalGenerations;
+
+		// Stop early once more generations aren't buying anything
+		m_stopReason = m_convergence.update(m_phrasePool->GetPhrases());
+		recordTelemetry();
+
+		if (m_stopReason != conv_None) {
+
+			std::cout << "Run converged after " << m_totalGenerations << " generations: ";
+			std::cout << getConvergenceReasonName(m_stopReason) << std::endl;
+			return true;
+		}
+
+		return false;
+	}
+
+	void GeneticAlgorithmController::recordTelemetry() {
+
+		std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+		double generationMs = std::chrono::duration<double, std::milli>(now - m_generationStart).count();
+
+		GenerationStats stats;
+		stats.m_generation = m_totalGenerations;
+		stats.m_uniqueGenomes = m_convergence.getLatestStats().m_uniqueGenomes;
+
+		stats.m_childrenProduced = m_childrenThisGeneration;
+		stats.m_generationMs = static_cast<float>(generationMs);
+		stats.m_childrenPerSecond = (generationMs > 0.0) ? static_cast<float>(m_childrenThisGeneration * 1000.0 / generationMs) : 0.0f;
+
+		for (uint32_t stage = 0; stage < stage_Count; ++stage) {
+
+			stats.m_stageMs[stage] = static_cast<float>(m_stageTimes[stage]);
+			m_stageTimes[stage] = 0.0;
+		}
+
+		stats.m_allocatorUsed = m_phrasePool->GetAllocatedCount();
+		stats.m_allocatorCapacity = m_phrasePool->GetAllocatorCapacity();
+
+		m_telemetry.recordGeneration(m_phrasePool->GetPhrases(), stats);
+
+		m_childrenThisGeneration = 0;
+		m_generationStart = now;
+	}
+
+	void GeneticAlgorithmController::settlePopulation() {
+
+		if (m_packedPopulation) {
+			m_phrasePool->PackPopulation();
+		}
+
+		// Displayed, played and edited between runs, so it keeps a grid
+		m_activePhrase = m_phrasePool->GetPhrases()[0];
+		m_phrasePool->UnpackPhrase(m_activePhrase);
+	}
+
+	bool GeneticAlgorithmController::exportTelemetry(const std::string& filepath) {
+
+		return m_telemetry.exportToFile(filepath);
+	}
+
+	void GeneticAlgorithmController::getRandomEngines(std::mt19937* (&engines)[engine_Count]) {
+
+		engines[engine_Generator] = m_populationGen.GetRandomEngine();
+		engines[engine_Selection] = m_selection.GetRandomEngine();
+		engines[engine_Breeding] = m_breeding.GetRandomEngine();
+		engines[engine_Mutation] = m_mutation.GetRandomEngine();
+		engines[engine_Replacement] = m_phrasePool->GetReplacementEngine();
+	}
+
+	bool GeneticAlgorithmController::saveCheckpoint(const std::string& filepath) {
+
+		// Shape comes from the pool, a pending setPhraseShape hasn't been applied to it yet
+		CheckpointState state;
+		state.m_measureCount = m_phrasePool->GetMeasuresPerPhrase();
+		state.m_subdivision = m_phrasePool->GetSmallestSubDivision();
+		state.m_generation = m_totalGenerations;
+		state.m_nextPhraseID = m_phrasePool->GetLastPhraseID();
+		state.m_seed = m_seed;
+		state.m_seeded = m_seeded;
+		state.m_fixedRecords = m_fixedCheckpointRecords;
+
+		getRandomEngines(state.m_engines);
+
+		return writeCheckpoint(filepath, m_phrasePool->GetPhrases(), state);
+	}
+
+	void GeneticAlgorithmController::setFixedCheckpointRecords(bool fixedRecords) {
+
+		m_fixedCheckpointRecords = fixedRecords;
+	}
+
+	bool GeneticAlgorithmController::loadCheckpoint(const std::string& filepath) {
+
+		CheckpointReader reader;
+		if (!reader.open(filepath)) {
+			return false;
+		}
+
+		const CheckpointHeader& header = reader.getHeader();
+		if (header.m_phraseCount == 0) {
+
+			std::cout << filepath << " doesn't hold any phrases" << std::endl;
+			return false;
+		}
+
+		// Rebuild the pool at the checkpoint's shape and size, then copy each record straight in
+		delete m_phrasePool;
+
+		m_populationSize = header.m_phraseCount;
+		m_populationGen.SetConfiguration({ static_cast<int>(header.m_measureCount), static_cast<int>(header.m_subdivision) });
+		m_populationGen.resetAllocator(m_populationSize);
+
+		m_phrasePool = m_populationGen.AllocatePopulation();
+		for (uint32_t i = 0; i < header.m_phraseCount; ++i) {
+			reader.restorePhrase(i, m_phrasePool->AllocateChild());
+		}
+		m_phrasePool->MergeChildrenToPopulation<GenerationalPrune>();
+
+		// Allocating bumped the ID counter, put it back where the saved run left it
+		m_phrasePool->SetLastPhraseID(header.m_nextPhraseID);
+
+		m_totalGenerations = header.m_generation;
+		m_seed = header.m_seed;
+		m_seeded = (header.m_seeded != 0);
+
+		std::mt19937* engines[engine_Count];
+		getRandomEngines(engines);
+
+		for (uint32_t engine = 0; engine < engine_Count; ++engine) {
+
+			if (engines[engine] && !reader.restoreEngine(static_cast<CheckpointEngine>(engine), *engines[engine])) {
+				GA_LOG_WARNING("Random engine %u wasn't restored from %s, it keeps its current state", engine, filepath.c_str());
+			}
+		}
+
+		m_hallOfFame.offerAll(m_phrasePool->GetPhrases());
+		m_convergence.reset();
+		m_integrity.reset();
+
+		settlePopulation();
+		return true;
+	}
+
+	void GeneticAlgorithmController::runForTimeBudget() {
+
+		typedef std::chrono::steady_clock Clock;
+		typedef std::chrono::duration<double> Seconds;
+
+		Clock::time_point deadline = Clock::now() + std::chrono::milliseconds(m_timeBudgetMs);
+
+		uint32_t maxPopulation = m_populationGen.GetPopulationSize();
+		uint32_t childrenThisGeneration = 0;
+
+		while (true) {
+
+			double remaining = Seconds(deadline - Clock::now()).count();
+
+			// Don't start work that's expected to land mostly past the deadline
+			if (remaining <= 0.0 || remaining < m_childCostEstimate * 0.5) {
+				break;
+			}
+
+			// Size the batch so its predicted cost fits in what's left, capped so a bad estimate
+			// can never overshoot by more than one small batch
+			uint32_t batchSize = 1;
+			if (m_childCostEstimate > 0.0) {
+				batchSize = static_cast<uint32_t>(remaining / m_childCostEstimate);
+			}
+			batchSize = std::max<uint32_t>(1, std::min<uint32_t>(batchSize, MaxBudgetBatchSize));
+			batchSize = std::min(batchSize, maxPopulation - childrenThisGeneration);
+
+			Clock::time_point batchStart = Clock::now();
+			for (uint32_t i = 0; i < batchSize; ++i) {
+
+				produceChild();
+				if (m_steadyState) {
+
+					GA_PROFILE_SCOPE("Merge");
+					StageTimer timer(m_stageTimes[stage_Merge]);
+					m_phrasePool->ReplaceIntoPopulation<ReplacementType>();
+				}
+			}
+
+			// Smooth the measured cost, rule sets and phrase contents change how long a child takes
+			double childCost = Seconds(Clock::now() - batchStart).count() / batchSize;
+			m_childCostEstimate = (m_childCostEstimate > 0.0) ?
+				m_childCostEstimate + ChildCostSmoothing * (childCost - m_childCostEstimate) : childCost;
+
+			childrenThisGeneration += batchSize;
+			if (childrenThisGeneration == maxPopulation) {
+
+				if (!m_steadyState) {
+
+					GA_PROFILE_SCOPE("Merge");
+					StageTimer timer(m_stageTimes[stage_Merge]);
+					m_phrasePool->MergeChildrenToPopulation<PruningType>();
+				}
+
+				childrenThisGeneration = 0;
+				if (finishGeneration()) {
+					break;
+				}
+			}
+		}
+
+		// Out of time mid generation, the partial batch competes with the parents so the population
+		// keeps its size whichever pruning policy is in use
+		if (m_phrasePool->GetNumChildren() > 0) {
+			m_phrasePool->MergeChildrenToPopulation<ElitistPrune>();
+		}
+	}
+
+	Phrase* GeneticAlgorithmController::produceChild() {
+
+		GA_LOG_TRACE("Starting selection step...");
+
+		// Decided up front so a sampled child is checked after both breeding and mutation
+		bool sampled = m_integrity.sampleNext();
+
+		// Select a new set of parents
+		BreedingPair selected;
+		{
+			GA_PROFILE_SCOPE("Selection");
+			StageTimer timer(m_stageTimes[stage_Selection]);
+			selected = m_selection.SelectPair(m_phrasePool);
+		}
+
+		// Operators work on grids, packed parents are unpacked here and packed again below. Timed
+		// on their own so the packed form's cost doesn't hide in the operators' numbers
+		if (m_packedPopulation) {
+
+			GA_PROFILE_SCOPE("Packing");
+			StageTimer timer(m_stageTimes[stage_Packing]);
+			m_phrasePool->UnpackPhrase(selected.first);
+			m_phrasePool->UnpackPhrase(selected.second);
+		}
+
+		GA_LOG_TRACE("Starting breeding step...");
+
+		// Breed the phrases together and produce an output (auto added as child in pool)
+		{
+			GA_PROFILE_SCOPE("Breeding");
+			StageTimer timer(m_stageTimes[stage_Breeding]);
+			m_breeding.Breed(selected, m_phrasePool);
+		}
+		Phrase* child = m_phrasePool->GetChildren().back();
+		bool corrupt = sampled && !m_integrity.check(child, 0);
+
+#ifdef _DEBUG
+		GA_Error errorCode = validateNoteCount(child);
+		printErrorMessage(errorCode);
+
+		errorCode = validateNoteLengths(child);
+		printErrorMessage(errorCode);
+
+		errorCode = validateRestOccurances(child);
+		printErrorMessage(errorCode);
+#endif
+		GA_LOG_TRACE("Starting mutation step...");
+
+		// Apply a mutation to the child to introduce some variety
+		{
+			GA_PROFILE_SCOPE("Mutation");
+			StageTimer timer(m_stageTimes[stage_Mutation]);
+			m_mutation.Mutate(child);
+		}
+
+		if (sampled && !corrupt) {
+			corrupt = !m_integrity.check(child, 1 + m_mutation.GetLastMutation());
+		}
+
+		// Swap the corrupt genome for a parent's before it's scored, so the child count and
+		// population size stay the same whichever merge or replacement policy runs next
+		if (corrupt && m_integrity.getSettings().m_quarantine) {
+			m_integrity.quarantine(child, selected.first ? selected.first : selected.second);
+		}
+
+#ifdef _DEBUG
+		errorCode = validateNoteCount(child);
+		printErrorMessage(errorCode);
+
+		errorCode = validateNoteLengths(child);
+		printErrorMessage(errorCode);
+#endif 
+		GA_LOG_TRACE("Starting assessment step...");
+
+		// Evaluate the fitness of the new phrase
+		{
+			GA_PROFILE_SCOPE("Assessment");
+			StageTimer timer(m_stageTimes[stage_Assessment]);
+			m_fitness.Assess(child);
+		}
+
+		// Archive it now, it may not survive the merge or replacement
+		m_hallOfFame.offer(child);
+
+		// The archive keeps its copy as a grid, the population's go back to packed
+		if (m_packedPopulation) {
+
+			GA_PROFILE_SCOPE("Packing");
+			StageTimer timer(m_stageTimes[stage_Packing]);
+			m_phrasePool->PackPhrase(child);
+			m_phrasePool->PackPhrase(selected.first);
+			m_phrasePool->PackPhrase(selected.second);
+		}
+
+		++m_childrenThisGeneration;
+		return child;
+	}
+
+	void GeneticAlgorithmController::runGeneration() {
+
+		uint32_t maxPopulation = m_populationGen.GetPopulationSize();
+
+		// Check if we've generated enough children to fill a generation
+		while (m_phrasePool->GetNumChildren() < maxPopulation) {
+			produceChild();
+		}
+
+		// Once we have enough children, prune the population back 
+		GA_PROFILE_SCOPE("Merge");
+		StageTimer timer(m_stageTimes[stage_Merge]);
+		m_phrasePool->MergeChildrenToPopulation<PruningType>();
+	}
+
+	void GeneticAlgorithmController::runSteadyState() {
+
+		// A "generation" is still population size children so the iteration count means the same
+		// thing in both modes, but each child goes straight into the population and can be selected next
+		uint32_t maxPopulation = m_populationGen.GetPopulationSize();
+		for (uint32_t i = 0; i < maxPopulation; ++i) {
+
+			produceChild();
+
+			GA_PROFILE_SCOPE("Merge");
+			StageTimer timer(m_stageTimes[stage_Merge]);
+			m_phrasePool->ReplaceIntoPopulation<ReplacementType>();
+		}
+	}
+
+	void GeneticAlgorithmController::updateAudioEngine() {
+		
+		if (m_audioEnabled) {
+			m_audioEngine.Update();
+		}
+	}
+
+	void GeneticAlgorithmController::shutdownAlgorithm() {
+
+		if (m_audioEnabled) {
+
+			m_audioEngine.StopAll();
+			m_audioEngine.Shutdown();
+		}
+
+		// The workers only stop once the last controller lets go
+		if (m_holdsScheduler) {
+
+			TaskScheduler::getScheduler().release();
+			m_holdsScheduler = false;
+		}
+	}
+
+
+	void GeneticAlgorithmController::setMeterInfoStruct(const MeterInfo& meterData) {
+
+		
+	}
+
+	void GeneticAlgorithmController::setPhrasePoolSize(uint32_t populationSize) {
+
+		m_populationSize = populationSize;
+	}
+
+
+	void GeneticAlgorithmController::setPhraseShape(uint32_t measureCount, uint32_t subdivision) {
+
+		m_populationGen.SetConfiguration({ static_cast<int>(measureCount), static_cast<int>(subdivision) });
+	}
+
+	void GeneticAlgorithmController::setSeed(uint32_t seed) {
+
+		m_seed = seed;
+		m_seeded = true;
+
+		// Offset each engine so the operators don't all draw the same sequence
+		m_populationGen.Seed(seed);
+		m_selection.Seed(seed + 1);
+		m_breeding.Seed(seed + 2);
+		m_mutation.Seed(seed + 3);
+
+		m_phrasePool->SeedReplacement(seed + 4);
+	}
+
+	// One line for the console, the reason each file failed goes to the log
+	static void printImportStats(const std::string& directory, const CorpusImportStats& stats) {
+
+		std::cout << "Read " << stats.m_filesImported << " of " << stats.m_filesRequested << " MIDI files from " << directory
+				  << " (" << stats.m_notesRead << " notes, " << stats.m_bytesRead / 1024 << " KB) in " << stats.m_seconds << "s";
+
+		if (!stats.m_failures.empty()) {
+			std::cout << ", " << stats.m_failures.size() << " couldn't be read";
+		}
+
+		std::cout << std::endl;
+	}
+
+	bool GeneticAlgorithmController::setSeedCorpus(const std::string& directory) {
+
+		if (directory.empty()) {
+
+			m_populationGen.ClearCorpus();
+			return true;
+		}
+
+		CorpusImportStats stats;
+		uint32_t imported = m_populationGen.LoadCorpus(directory, &stats);
+		printImportStats(directory, stats);
+
+		if (imported == 0) {
+
+			std::cout << "No usable MIDI files found in " << directory << std::endl;
+			return false;
+		}
+
+		return true;
+	}
+
+	bool GeneticAlgorithmController::trainMarkovModel(const std::string& directory) {
+
+		MelodyCorpus corpus;
+		CorpusImportStats stats;
+		uint32_t imported = corpus.importDirectory(directory, &stats);
+		printImportStats(directory, stats);
+
+		if (imported == 0) {
+
+			std::cout << "No usable MIDI files found in " << directory << std::endl;
+			return false;
+		}
+
+		return m_markovModel.train(corpus);
+	}
+
+	bool GeneticAlgorithmController::loadMarkovModel(const std::string& filepath) {
+
+		return m_markovModel.load(filepath);
+	}
+
+	bool GeneticAlgorithmController::saveMarkovModel(const std::string& filepath) const {
+
+		return m_markovModel.save(filepath);
+	}
+
+	void GeneticAlgorithmController::setIterationCount(uint32_t iterations) {
+
+		m_iterationsPerStep = iterations;
+	}
+
+	void GeneticAlgorithmController::setTimeBudget(uint32_t milliseconds) {
+
+		m_timeBudgetMs = milliseconds;
+	}
+
+	void GeneticAlgorithmController::setWorkerCount(uint32_t workerCount) {
+
+		m_workerCount = workerCount;
+		reconfigureScheduler();
+	}
+
+	void GeneticAlgorithmController::setWorkerPinning(bool pinWorkers) {
+
+		m_pinWorkers = pinWorkers;
+		reconfigureScheduler();
+	}
+
+	void GeneticAlgorithmController::reconfigureScheduler() {
+
+		// Restarts the workers, only ever called between runs so nothing of ours is in flight. Other
+		// controllers might have work in flight though, so they keep the pool as it is
+		if (!TaskScheduler::getScheduler().reconfigure(m_workerCount, m_pinWorkers)) {
+			GA_LOG_WARNING("Scheduler is shared with another controller, keeping its %u workers", TaskScheduler::getScheduler().getWorkerCount());
+		}
+	}
+
+	void GeneticAlgorithmController::setSteadyState(bool steadyState) {
+
+		// Safe to flip between runs, both modes leave the child list empty and the population sorted
+		m_steadyState = steadyState;
+	}
+
+	void GeneticAlgorithmController::setPackedPopulation(bool packedPopulation) {
+
+		// Members are packed from the next run on, turning it off gives them all their grids back now
+		m_packedPopulation = packedPopulation;
+		if (!m_packedPopulation) {
+			m_phrasePool->UnpackPopulation();
+		}
+	}
+
+	void GeneticAlgorithmController::setConvergenceCriteria(const ConvergenceCriteria& criteria) {
+
+		m_convergence.setCriteria(criteria);
+	}
+
+	void GeneticAlgorithmController::setStopOnConvergence(bool stopOnConvergence) {
+
+		ConvergenceCriteria criteria = m_convergence.getCriteria();
+		criteria.m_enabled = stopOnConvergence;
+
+		m_convergence.setCriteria(criteria);
+	}
+
+	void GeneticAlgorithmController::setPlateauGenerations(uint32_t generations) {
+
+		ConvergenceCriteria criteria = m_convergence.getCriteria();
+		criteria.m_plateauGenerations = generations;
+
+		m_convergence.setCriteria(criteria);
+	}
+
+	void GeneticAlgorithmController::setIntegritySettings(const IntegritySettings& settings) {
+
+		m_integrity.setSettings(settings);
+	}
+
+	void GeneticAlgorithmController::clearPhrasePool() {
+
+		// Delete the current phrase pool
+		// The new pool numbers its phrases from one again
+		delete m_phrasePool;
+
+		// Reset the allocator for the population
+		m_populationGen.resetAllocator(m_populationSize);
+
+		// Regenerate a new base population
+		m_phrasePool = m_populationGen.GeneratePopulation();
+
+		if (m_seeded) {
+			m_phrasePool->SeedReplacement(m_seed + 4);
+		}
+
+#ifdef _DEBUG
+		const std::vector<Phrase*>& phraseVec = m_phrasePool->GetPhrases();
+		for (Phrase* currPhrase : phraseVec) {
+
+			GA_Error errorCode = validateRestOccurances(currPhrase);
+			printErrorMessage(errorCode);
+		}
+#endif
+
+		// Rescore the fresh pool for a starting point
+		m_fitness.Assess(m_phrasePool);
+		m_hallOfFame.offerAll(m_phrasePool->GetPhrases());
+		m_convergence.reset();
+		m_integrity.reset();
+
+		// Set active to the current front of the phrase list
+		settlePopulation();
+	}
+
+	void GeneticAlgorithmController::setActivePhrase(uint32_t phraseID) {
+
+		const PhraseVec& phrases = m_phrasePool->GetPhrases();
+		for (Phrase* phrase : phrases) {
+			
+			if (phrase->_phraseID == phraseID) {
+
+				m_phrasePool->UnpackPhrase(phrase);
+				m_activePhrase = phrase;
+				return;
+			}
+		}
+	}
+
+
+	uint32_t GeneticAlgorithmController::getActivePhraseID() const {
+
+		return m_activePhrase->_phraseID;
+	}
+
+	Phrase* GeneticAlgorithmController::getActivePhrase() const {
+
+		return m_activePhrase;
+	}
+
+
+	const std::vector<Phrase*>& GeneticAlgorithmController::getPhraseList() const {
+
+		return m_phrasePool->GetPhrases();
+	}
+
+	const std::vector<Phrase*>& GeneticAlgorithmController::getHallOfFame() const {
+
+		return m_hallOfFame.getEntries();
+	}
+
+	bool GeneticAlgorithmController::setHallOfFameMemoryBudget(size_t residentBytes, const std::string& spillPath) {
+
+		return m_hallOfFame.setMemoryBudget(residentBytes, spillPath);
+	}
+
+	Phrase* GeneticAlgorithmController::loadHallOfFameEntry(uint32_t rank) {
+
+		return m_hallOfFame.loadEntry(rank);
+	}
+
+	void GeneticAlgorithmController::clearHallOfFame() {
+
+		m_hallOfFame.clear();
+	}
+
+	void GeneticAlgorithmController::setHallOfFameSize(uint32_t archiveSize) {
+
+		m_hallOfFame.setCapacity(archiveSize);
+	}
+
+
+	void GeneticAlgorithmController::exportPhraseToMIDI(const std::string& filepath, Phrase* phrase) const {
+
+		MIDIHandler midiOutput;
+		phrase = (phrase == nullptr) ? m_activePhrase : phrase;
+		m_phrasePool->UnpackPhrase(phrase);
+
+		midiOutput.writeToMIDI(phrase, filepath);
+	}
+
+	void GeneticAlgorithmController::importMIDIToPhrase(const std::string& filepath, Phrase* phrase) {
+
+		MIDIHandler midiInput;
+
+		phrase = (phrase == nullptr) ? m_activePhrase : phrase;
+		m_phrasePool->UnpackPhrase(phrase);
+		phrase->makeUnique();
+		
+		std::memset(phrase->_melodicData, 0, phrase->_smallestSubdivision * phrase->_numMeasures);
+		std::memset(phrase->_melodicRhythm, 0, phrase->_smallestSubdivision * phrase->_numMeasures);
+		phrase->_melodicNotes = 0;
+
+		midiInput.readFromMIDI(m_activePhrase, filepath);
+	}
+
+
+	void GeneticAlgorithmController::playCurrentlySelectedPhrase() {
+	
+		if (m_audioEnabled) {
+			m_audioEngine.Play(m_activePhrase);
+		}
+	}
+
+	void GeneticAlgorithmController::pauseCurrentlySelectedPhrase() {
+
+	}
+
+	void GeneticAlgorithmController::stopCurrentlySelectedPhrase() {
+
+		if (m_audioEnabled) {
+			m_audioEngine.StopAll();
+		}
+	}
+
+
+	void GeneticAlgorithmController::setPlaybackSynthesizer(SynthesizerBase* synth) {
+
+		if (m_activeSynth) {
+			delete m_activeSynth;
+		}
+
+		m_activeSynth = synth;
+	}
+
+
 } // namespace Genetics
\ No newline at end of file
@@ -0,0 +1,556 @@
+// Morgen Hyde
+
+#include "Generation/MarkovModel.h"
+#include "Generation/MelodyCorpus.h"
+#include "FileIO/MIDIFiles.h"
+#include "GADefaultConfig.h"
+#include "Phrase.h"
+#include "Utility/Profiler.h"
+
+#include <algorithm> // std::min, std::max
+#include <cstring>   // std::memcpy, std::memset, std::memcmp
+#include <fstream>
+#include <iostream>  // std::cout
+
+namespace Genetics {
+
+	static __inline uint32_t intervalSymbol(int interval) {
+
+		return static_cast<uint32_t>(std::min(std::max(interval, -MarkovIntervalRange), MarkovIntervalRange) + MarkovIntervalRange);
+	}
+
+	// Rows go out as alias tables built with Vose's method, each entry starts with its share of the
+	// row scaled so an even share is 1. Entries under 1 are topped up from one that's over
+	static void appendRow(std::vector<MarkovEntry>& entries, const uint32_t* counts, uint32_t symbolCount) {
+
+		const size_t rowStart = entries.size();
+
+		uint64_t total = 0;
+		for (uint32_t symbol = 0; symbol < symbolCount; ++symbol) {
+
+			if (counts[symbol] != 0) {
+
+				entries.push_back({ static_cast<uint16_t>(symbol), 0, 0.0f });
+				total += counts[symbol];
+			}
+		}
+
+		const uint32_t rowSize = static_cast<uint32_t>(entries.size() - rowStart);
+		if (rowSize == 0) {
+			return;
+		}
+
+		std::vector<double> scaled(rowSize);
+		std::vector<uint32_t> under;
+		std::vector<uint32_t> over;
+
+		for (uint32_t entry = 0; entry < rowSize; ++entry) {
+
+			scaled[entry] = static_cast<double>(counts[entries[rowStart + entry].m_symbol]) * rowSize / static_cast<double>(total);
+			(scaled[entry] < 1.0 ? under : over).push_back(entry);
+		}
+
+		while (!under.empty() && !over.empty()) {
+
+			uint32_t small = under.back();
+			under.pop_back();
+			uint32_t large = over.back();
+			over.pop_back();
+
+			entries[rowStart + small].m_threshold = static_cast<float>(scaled[small]);
+			entries[rowStart + small].m_alias = static_cast<uint16_t>(large);
+
+			scaled[large] = (scaled[large] + scaled[small]) - 1.0;
+			(scaled[large] < 1.0 ? under : over).push_back(large);
+		}
+
+		// Whatever's left is a full share give or take rounding, it always keeps its own symbol
+		for (uint32_t entry : under) {
+			entries[rowStart + entry] = { entries[rowStart + entry].m_symbol, static_cast<uint16_t>(entry), 1.0f };
+		}
+		for (uint32_t entry : over) {
+			entries[rowStart + entry] = { entries[rowStart + entry].m_symbol, static_cast<uint16_t>(entry), 1.0f };
+		}
+	}
+
+	// Appends a table built from counts[context * symbolCount + symbol], returns its byte offset
+	static uint32_t appendTable(std::vector<uint32_t>& image, const std::vector<uint32_t>& counts, uint32_t contextCount, uint32_t symbolCount) {
+
+		const size_t tableStart = image.size();
+		const size_t rowStartsIndex = tableStart + sizeof(MarkovTableHeader) / sizeof(uint32_t);
+
+		image.resize(rowStartsIndex + contextCount + 1);
+
+		std::vector<MarkovEntry> entries;
+		for (uint32_t context = 0; context < contextCount; ++context) {
+
+			image[rowStartsIndex + context] = static_cast<uint32_t>(entries.size());
+			appendRow(entries, counts.data() + static_cast<size_t>(context) * symbolCount, symbolCount);
+		}
+
+		image[rowStartsIndex + contextCount] = static_cast<uint32_t>(entries.size());
+
+		MarkovTableHeader header = { contextCount, static_cast<uint32_t>(entries.size()) };
+		std::memcpy(image.data() + tableStart, &header, sizeof(header));
+
+		const size_t entriesIndex = image.size();
+		image.resize(entriesIndex + entries.size() * sizeof(MarkovEntry) / sizeof(uint32_t));
+		std::memcpy(image.data() + entriesIndex, entries.data(), entries.size() * sizeof(MarkovEntry));
+
+		return static_cast<uint32_t>(tableStart * sizeof(uint32_t));
+	}
+
+	MarkovModel::MarkovModel()
+		: m_header(nullptr) {
+
+		std::memset(m_tables, 0, sizeof(m_tables));
+	}
+
+	MarkovModel::~MarkovModel() {
+	}
+
+	bool MarkovModel::train(const MelodyCorpus& corpus) {
+
+		GA_PROFILE_SCOPE("MarkovModel::train");
+
+		clear();
+
+		const uint32_t measureLength = MIDIHandler::MIDIMeasureSlots;
+		m_rhythmDictionary.build(measureLength, 1);
+
+		const uint32_t patternCount = m_rhythmDictionary.size();
+		const uint32_t intervalContexts = MarkovIntervalSymbols * MarkovIntervalSymbols;
+
+		std::vector<uint32_t> pitchCounts(MarkovPitchSymbols, 0);
+		std::vector<uint32_t> interval0Counts(MarkovIntervalSymbols, 0);
+		std::vector<uint32_t> interval1Counts(MarkovIntervalSymbols * MarkovIntervalSymbols, 0);
+		std::vector<uint32_t> interval2Counts(intervalContexts * MarkovIntervalSymbols, 0);
+		std::vector<uint32_t> rhythmStartCounts(patternCount, 0);
+		std::vector<uint32_t> rhythm0Counts(patternCount, 0);
+		std::vector<uint32_t> rhythm1Counts(static_cast<size_t>(patternCount) * patternCount, 0);
+
+		uint32_t noteTotal = 0;
+		std::vector<uint32_t> onsets;
+		std::vector<int> notePitches;
+		std::vector<uint16_t> measureMasks;
+
+		for (uint32_t melody = 0; melody < corpus.getMelodyCount(); ++melody) {
+
+			const std::vector<char>& pitches = corpus.getMelodyPitches(melody);
+			const std::vector<char>& rhythm = corpus.getMelodyRhythm(melody);
+			const uint32_t melodyLength = static_cast<uint32_t>(rhythm.size());
+
+			// Only the sounding notes count, a rest just lengthens the note before it the same way
+			// the corpus windows fold them
+			onsets.clear();
+			notePitches.clear();
+
+			for (uint32_t slot = 0; slot < melodyLength; slot += rhythm[slot]) {
+
+				if (pitches[slot] != 0) {
+
+					onsets.push_back(slot);
+					notePitches.push_back(pitches[slot]);
+				}
+			}
+
+			if (onsets.empty()) {
+				continue;
+			}
+
+			noteTotal += static_cast<uint32_t>(onsets.size());
+
+			uint32_t previous[2] = { 0, 0 };
+			for (size_t note = 0; note < notePitches.size(); ++note) {
+
+				++pitchCounts[notePitches[note] & 0x7F];
+
+				if (note == 0) {
+					continue;
+				}
+
+				uint32_t interval = intervalSymbol(notePitches[note] - notePitches[note - 1]);
+
+				++interval0Counts[interval];
+				if (note >= 2) {
+					++interval1Counts[previous[1] * MarkovIntervalSymbols + interval];
+				}
+				if (note >= 3) {
+					++interval2Counts[(previous[0] * MarkovIntervalSymbols + previous[1]) * MarkovIntervalSymbols + interval];
+				}
+
+				previous[0] = previous[1];
+				previous[1] = interval;
+			}
+
+			// Every measure from the first note to the last becomes the nearest pattern to its onsets.
+			// Patterns always start a note on the bar line, so a note held over it counts as one there
+			const uint32_t firstMeasure = onsets.front() / measureLength;
+			const uint32_t lastMeasure = onsets.back() / measureLength;
+
+			measureMasks.assign(lastMeasure - firstMeasure + 1, 1);
+			for (uint32_t onset : onsets) {
+				measureMasks[onset / measureLength - firstMeasure] |= static_cast<uint16_t>(1u << (onset % measureLength));
+			}
+
+			uint16_t previousPattern = InvalidRhythmPattern;
+			for (size_t measure = 0; measure < measureMasks.size(); ++measure) {
+
+				uint16_t pattern = m_rhythmDictionary.findNearestPattern(measureMasks[measure]);
+
+				++rhythm0Counts[pattern];
+				if (measure == 0) {
+					++rhythmStartCounts[pattern];
+				}
+				else {
+					++rhythm1Counts[static_cast<size_t>(previousPattern) * patternCount + pattern];
+				}
+
+				previousPattern = pattern;
+			}
+		}
+
+		if (noteTotal == 0) {
+
+			std::cout << "The corpus has no notes to train a model on" << std::endl;
+			return false;
+		}
+
+		// The header's slot is reserved up front and filled in once the table offsets are known
+		std::vector<uint32_t>& image = m_trainedImage;
+		image.assign(sizeof(MarkovFileHeader) / sizeof(uint32_t), 0);
+
+		MarkovFileHeader header;
+		std::memset(&header, 0, sizeof(header));
+		std::memcpy(header.m_magic, "GMMK", 4);
+
+		header.m_version = MarkovFileVersion;
+		header.m_byteOrder = MarkovByteOrder;
+		header.m_headerSize = sizeof(MarkovFileHeader);
+		header.m_measureLength = measureLength;
+		header.m_patternCount = patternCount;
+
+		header.m_tableOffsets[markov_Pitch]       = appendTable(image, pitchCounts, 1, MarkovPitchSymbols);
+		header.m_tableOffsets[markov_Interval0]   = appendTable(image, interval0Counts, 1, MarkovIntervalSymbols);
+		header.m_tableOffsets[markov_Interval1]   = appendTable(image, interval1Counts, MarkovIntervalSymbols, MarkovIntervalSymbols);
+		header.m_tableOffsets[markov_Interval2]   = appendTable(image, interval2Counts, intervalContexts, MarkovIntervalSymbols);
+		header.m_tableOffsets[markov_RhythmStart] = appendTable(image, rhythmStartCounts, 1, patternCount);
+		header.m_tableOffsets[markov_Rhythm0]     = appendTable(image, rhythm0Counts, 1, patternCount);
+		header.m_tableOffsets[markov_Rhythm1]     = appendTable(image, rhythm1Counts, patternCount, patternCount);
+
+		header.m_fileSize = static_cast<uint32_t>(image.size() * sizeof(uint32_t));
+		std::memcpy(image.data(), &header, sizeof(header));
+
+		return attach(reinterpret_cast<const char*>(image.data()), header.m_fileSize, "the trained model");
+	}
+
+	bool MarkovModel::save(const std::string& filepath) const {
+
+		if (!isReady()) {
+
+			std::cout << "No model to save to " << filepath << std::endl;
+			return false;
+		}
+
+		std::ofstream modelFile(filepath, std::ios::binary);
+		if (!modelFile.is_open()) {
+
+			std::cout << "Unable to open model file " << filepath << std::endl;
+			return false;
+		}
+
+		// The image is the file, whichever way it came to be in memory
+		modelFile.write(reinterpret_cast<const char*>(m_header), m_header->m_fileSize);
+		if (!modelFile.good()) {
+
+			std::cout << "Failed writing model file " << filepath << std::endl;
+			return false;
+		}
+
+		return true;
+	}
+
+	bool MarkovModel::load(const std::string& filepath) {
+
+		clear();
+
+		if (!m_mappedImage.open(filepath)) {
+			return false;
+		}
+
+		if (!attach(m_mappedImage.data(), m_mappedImage.size(), filepath)) {
+
+			clear();
+			return false;
+		}
+
+		return true;
+	}
+
+	void MarkovModel::clear() {
+
+		m_header = nullptr;
+		std::memset(m_tables, 0, sizeof(m_tables));
+
+		m_trainedImage.clear();
+		m_mappedImage.close();
+	}
+
+	bool MarkovModel::attach(const char* image, size_t size, const std::string& source) {
+
+		const MarkovFileHeader* header = reinterpret_cast<const MarkovFileHeader*>(image);
+
+		bool valid = size >= sizeof(MarkovFileHeader) && std::memcmp(header->m_magic, "GMMK", 4) == 0;
+		if (!valid) {
+
+			std::cout << source << " is not a model file" << std::endl;
+			return false;
+		}
+
+		if (header->m_byteOrder != MarkovByteOrder) {
+
+			std::cout << source << " was written on a machine with a different byte order" << std::endl;
+			return false;
+		}
+
+		if (header->m_version != MarkovFileVersion || header->m_headerSize != sizeof(MarkovFileHeader)) {
+
+			std::cout << source << " is model version " << header->m_version << ", expected " << MarkovFileVersion << std::endl;
+			return false;
+		}
+
+		// Pattern IDs only mean something against the same dictionary
+		valid = header->m_fileSize == size && m_rhythmDictionary.build(header->m_measureLength, 1) &&
+		        m_rhythmDictionary.size() == header->m_patternCount;
+
+		const uint32_t expectedContexts[markov_TableCount] = { 1, 1, MarkovIntervalSymbols, MarkovIntervalSymbols * MarkovIntervalSymbols, 1, 1, header->m_patternCount };
+		const uint32_t symbolCounts[markov_TableCount] = { MarkovPitchSymbols, MarkovIntervalSymbols, MarkovIntervalSymbols, MarkovIntervalSymbols,
+		                                                   header->m_patternCount, header->m_patternCount, header->m_patternCount };
+
+		// Every row and symbol is checked once here so sampling never has to
+		for (uint32_t tableID = 0; tableID < markov_TableCount && valid; ++tableID) {
+
+			uint64_t offset = header->m_tableOffsets[tableID];
+			if ((offset & 3) != 0 || offset + sizeof(MarkovTableHeader) > size) {
+
+				valid = false;
+				break;
+			}
+
+			const MarkovTableHeader* tableHeader = reinterpret_cast<const MarkovTableHeader*>(image + offset);
+			uint64_t rowStartsOffset = offset + sizeof(MarkovTableHeader);
+			uint64_t entriesOffset = rowStartsOffset + (static_cast<uint64_t>(tableHeader->m_contextCount) + 1) * sizeof(uint32_t);
+
+			if (tableHeader->m_contextCount != expectedContexts[tableID] ||
+			    entriesOffset + static_cast<uint64_t>(tableHeader->m_entryCount) * sizeof(MarkovEntry) > size) {
+
+				valid = false;
+				break;
+			}
+
+			MarkovTable& table = m_tables[tableID];
+			table.m_rowStarts = reinterpret_cast<const uint32_t*>(image + rowStartsOffset);
+			table.m_entries = reinterpret_cast<const MarkovEntry*>(image + entriesOffset);
+			table.m_contextCount = tableHeader->m_contextCount;
+
+			valid = table.m_rowStarts[0] == 0 && table.m_rowStarts[table.m_contextCount] == tableHeader->m_entryCount;
+			for (uint32_t context = 0; context < table.m_contextCount && valid; ++context) {
+
+				uint32_t rowStart = table.m_rowStarts[context];
+				uint32_t rowEnd = table.m_rowStarts[context + 1];
+				valid = rowStart <= rowEnd;
+
+				for (uint32_t entry = rowStart; entry < rowEnd && valid; ++entry) {
+					valid = table.m_entries[entry].m_symbol < symbolCounts[tableID] && table.m_entries[entry].m_alias < rowEnd - rowStart;
+				}
+			}
+		}
+
+		if (!valid) {
+
+			std::cout << source << " is truncated or corrupt" << std::endl;
+			std::memset(m_tables, 0, sizeof(m_tables));
+			return false;
+		}
+
+		m_header = header;
+		return true;
+	}
+
+	bool MarkovModel::supports(const Phrase* phrase) const {
+
+		return isReady() && phrase->_smallestSubdivision == m_header->m_measureLength;
+	}
+
+	bool MarkovModel::drawSymbol(const MarkovTable& table, uint32_t context, std::mt19937& engine, uint16_t& symbol) {
+
+		const uint32_t rowStart = table.m_rowStarts[context];
+		const uint32_t rowSize = table.m_rowStarts[context + 1] - rowStart;
+
+		if (rowSize == 0) {
+			return false;
+		}
+
+		// One roll does both jobs, the whole part picks the entry and the fraction picks between it
+		// and its alias
+		std::uniform_real_distribution<double> distrib(0.0, static_cast<double>(rowSize));
+		double roll = distrib(engine);
+
+		uint32_t index = std::min(static_cast<uint32_t>(roll), rowSize - 1);
+		const MarkovEntry& entry = table.m_entries[rowStart + index];
+
+		symbol = (roll - index < entry.m_threshold) ? entry.m_symbol : table.m_entries[rowStart + entry.m_alias].m_symbol;
+		return true;
+	}
+
+	uint16_t MarkovModel::drawPattern(uint32_t measure, uint16_t previousPattern, std::mt19937& engine) const {
+
+		uint16_t pattern = 0;
+
+		if (measure == 0 && drawSymbol(m_tables[markov_RhythmStart], 0, engine, pattern)) {
+			return pattern;
+		}
+
+		if (measure != 0 && previousPattern != InvalidRhythmPattern && drawSymbol(m_tables[markov_Rhythm1], previousPattern, engine, pattern)) {
+			return pattern;
+		}
+
+		// Whole notes are pattern 0, only reached if the corpus somehow had no measures at all
+		return drawSymbol(m_tables[markov_Rhythm0], 0, engine, pattern) ? pattern : 0;
+	}
+
+	char MarkovModel::drawPitch(MelodyState& state, std::mt19937& engine) const {
+
+		uint16_t symbol = 0;
+
+		if (state.m_pitch == 0) {
+
+			int pitch = drawSymbol(m_tables[markov_Pitch], 0, engine, symbol) ? symbol : (MinPitch + MaxPitch) / 2;
+			state.m_pitch = std::min(std::max(pitch, static_cast<int>(MinPitch)), static_cast<int>(MaxPitch));
+
+			return static_cast<char>(state.m_pitch);
+		}
+
+		bool drawn = (state.m_intervalCount >= 2 && drawSymbol(m_tables[markov_Interval2], state.m_intervals[0] * MarkovIntervalSymbols + state.m_intervals[1], engine, symbol)) ||
+		             (state.m_intervalCount >= 1 && drawSymbol(m_tables[markov_Interval1], state.m_intervals[1], engine, symbol)) ||
+		             drawSymbol(m_tables[markov_Interval0], 0, engine, symbol);
+
+		int interval = drawn ? static_cast<int>(symbol) - MarkovIntervalRange : 0;
+		int pitch = state.m_pitch + interval;
+
+		// A leap out of range goes the other way instead, so the interval is still one the model chose
+		if (pitch > MaxPitch || pitch < MinPitch) {
+			pitch = state.m_pitch - interval;
+		}
+
+		pitch = std::min(std::max(pitch, static_cast<int>(MinPitch)), static_cast<int>(MaxPitch));
+
+		state.m_intervals[0] = state.m_intervals[1];
+		state.m_intervals[1] = intervalSymbol(pitch - state.m_pitch);
+		state.m_intervalCount = std::min(state.m_intervalCount + 1, 2u);
+		state.m_pitch = pitch;
+
+		return static_cast<char>(pitch);
+	}
+
+	void MarkovModel::writeMeasure(Phrase* phrase, uint32_t measure, uint16_t pattern, MelodyState& state, std::mt19937& engine) const {
+
+		const uint32_t measureLength = m_header->m_measureLength;
+
+		char* rhythm = phrase->_melodicRhythm + measure * measureLength;
+		char* pitches = phrase->_melodicData + measure * measureLength;
+
+		std::memcpy(rhythm, m_rhythmDictionary.getRhythm(pattern), measureLength);
+		std::memset(pitches, 0, measureLength);
+
+		for (uint32_t slot = 0; slot < measureLength; slot += rhythm[slot]) {
+			pitches[slot] = drawPitch(state, engine);
+		}
+	}
+
+	bool MarkovModel::generatePhrase(Phrase* phrase, std::mt19937& engine) const {
+
+		if (!supports(phrase)) {
+			return false;
+		}
+
+		phrase->makeUnique();
+
+		MelodyState state = { 0, { 0, 0 }, 0 };
+		uint32_t noteCount = 0;
+
+		uint16_t pattern = InvalidRhythmPattern;
+		for (uint32_t measure = 0; measure < phrase->_numMeasures; ++measure) {
+
+			pattern = drawPattern(measure, pattern, engine);
+			writeMeasure(phrase, measure, pattern, state, engine);
+			noteCount += m_rhythmDictionary.getNoteCount(pattern);
+		}
+
+		phrase->_melodicNotes = noteCount;
+		return true;
+	}
+
+	bool MarkovModel::resampleMeasure(Phrase* phrase, uint32_t measure, std::mt19937& engine) const {
+
+		if (!supports(phrase) || measure >= phrase->_numMeasures) {
+			return false;
+		}
+
+		const uint32_t measureLength = m_header->m_measureLength;
+		const uint32_t maxNotes = phrase->_numMeasures * measureLength;
+		const uint32_t measureStart = measure * measureLength;
+		const uint32_t measureEnd = measureStart + measureLength;
+
+		const char* rhythm = phrase->_melodicRhythm;
+		const char* pitches = phrase->_melodicData;
+
+		// The measure has to start and end on a note boundary to be swapped out on its own
+		if (rhythm[measureStart] == 0 || (measureEnd < maxNotes && rhythm[measureEnd] == 0)) {
+			return false;
+		}
+
+		uint32_t oldNotes = 0;
+		uint32_t slot = measureStart;
+		while (slot < measureEnd && rhythm[slot] > 0) {
+
+			slot += rhythm[slot];
+			++oldNotes;
+		}
+
+		if (slot != measureEnd) {
+			return false;
+		}
+
+		// The new notes follow on from the last three sounding notes before the bar line
+		int previous[3] = { 0, 0, 0 };
+		uint32_t found = 0;
+
+		for (slot = measureStart; slot > 0 && found < 3;) {
+
+			--slot;
+			if (rhythm[slot] != 0 && pitches[slot] != 0) {
+				previous[found++] = pitches[slot];
+			}
+		}
+
+		MelodyState state = { previous[0], { 0, 0 }, (found > 0) ? found - 1 : 0 };
+		if (found >= 2) {
+			state.m_intervals[1] = intervalSymbol(previous[0] - previous[1]);
+		}
+		if (found >= 3) {
+			state.m_intervals[0] = intervalSymbol(previous[1] - previous[2]);
+		}
+
+		// A measure before it that isn't a pattern (imported, merged across the bar) has no row
+		uint16_t previousPattern = (measure > 0) ? m_rhythmDictionary.findPattern(rhythm + measureStart - measureLength) : InvalidRhythmPattern;
+		uint16_t pattern = drawPattern(measure, previousPattern, engine);
+
+		phrase->makeUnique();
+		writeMeasure(phrase, measure, pattern, state, engine);
+
+		phrase->_melodicNotes = phrase->_melodicNotes - oldNotes + m_rhythmDictionary.getNoteCount(pattern);
+		return true;
+	}
+
+} // namespace Genetics
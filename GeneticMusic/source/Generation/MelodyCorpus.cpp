@@ -0,0 +1,307 @@
+// Morgen Hyde
+
+#include "Generation/MelodyCorpus.h"
+#include "FileIO/MIDIFiles.h"
+#include "Phrase.h"
+#include "Utility/DirectoryListing.h"
+#include "Utility/TaskScheduler.h"
+#include "Utility/Logger.h"
+#include "Utility/Profiler.h"
+
+#include <algorithm> // std::min, std::max
+#include <chrono>
+#include <cstring>   // std::memset
+
+namespace Genetics {
+
+	MelodyCorpus::MelodyCorpus()
+		: m_windowMeasures(0), m_windowSubdivision(0) {
+
+		m_rhythmDictionary.build(MIDIHandler::MIDIMeasureSlots, 1);
+	}
+
+	MelodyCorpus::~MelodyCorpus() {
+	}
+
+	// Files are handed out a few at a time, reading one is quick enough that single file tasks
+	// spend a good share of their time in the scheduler
+	static constexpr uint32_t CorpusImportGrainSize = 4;
+
+	// Past this many the failures are only counted in the log, the stats still list every one
+	static constexpr uint32_t CorpusLoggedFailures = 16;
+
+	uint32_t MelodyCorpus::importDirectory(const std::string& directory, CorpusImportStats* stats) {
+
+		GA_PROFILE_SCOPE("MelodyCorpus::importDirectory");
+
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+		clear();
+
+		std::vector<std::string> filepaths;
+		if (!listFiles(directory, { ".mid", ".midi" }, filepaths)) {
+
+			if (stats) {
+				*stats = CorpusImportStats();
+			}
+
+			return 0;
+		}
+
+		uint32_t imported = importFiles(filepaths, stats);
+
+		if (stats) {
+			stats->m_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		}
+
+		return imported;
+	}
+
+	uint32_t MelodyCorpus::importFiles(const std::vector<std::string>& filepaths, CorpusImportStats* stats) {
+
+		GA_PROFILE_SCOPE("MelodyCorpus::importFiles");
+
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+		struct FileResult {
+
+			CorpusMelody m_melody;
+			std::string m_error;
+			uint64_t m_bytes;
+			uint32_t m_notes;
+		};
+
+		// Every file lands in its own slot so the order matches the list however the tasks run, and
+		// nothing is shared between tasks until they've all finished
+		std::vector<FileResult> results(filepaths.size());
+
+		TaskScheduler::getScheduler().parallelFor(0, static_cast<uint32_t>(filepaths.size()), CorpusImportGrainSize,
+			[&filepaths, &results](uint32_t first, uint32_t last) {
+
+			// The handler keeps the events of the file being read, so each task needs its own
+			MIDIHandler handler;
+			for (uint32_t file = first; file < last; ++file) {
+
+				FileResult& result = results[file];
+				bool read = handler.readMelodyFromMIDI(filepaths[file], result.m_melody.m_pitches, result.m_melody.m_rhythm);
+
+				result.m_bytes = handler.getLastFileSize();
+				result.m_notes = 0;
+
+				if (!read) {
+					result.m_error = handler.getLastError();
+					continue;
+				}
+
+				const std::vector<char>& rhythm = result.m_melody.m_rhythm;
+				for (size_t slot = 0; slot < rhythm.size(); slot += std::max<size_t>(rhythm[slot], 1)) {
+					if (result.m_melody.m_pitches[slot] != 0) {
+						++result.m_notes;
+					}
+				}
+
+				// Files with nothing but rests are no use for seeding
+				if (result.m_notes == 0) {
+					result.m_error = "it holds no notes";
+					result.m_melody = CorpusMelody();
+				}
+			}
+		});
+
+		CorpusImportStats summary = CorpusImportStats();
+		summary.m_filesRequested = static_cast<uint32_t>(filepaths.size());
+
+		m_melodies.reserve(m_melodies.size() + filepaths.size());
+		for (size_t file = 0; file < filepaths.size(); ++file) {
+
+			FileResult& result = results[file];
+			summary.m_bytesRead += result.m_bytes;
+
+			if (!result.m_error.empty()) {
+
+				if (summary.m_failures.size() < CorpusLoggedFailures) {
+					GA_LOG_WARNING("Skipped %s, %s", filepaths[file].c_str(), result.m_error.c_str());
+				}
+
+				summary.m_failures.push_back({ filepaths[file], std::move(result.m_error) });
+				continue;
+			}
+
+			summary.m_notesRead += result.m_notes;
+			summary.m_measuresRead += result.m_melody.m_rhythm.size() / MIDIHandler::MIDIMeasureSlots;
+			m_melodies.push_back(std::move(result.m_melody));
+		}
+
+		summary.m_filesImported = summary.m_filesRequested - static_cast<uint32_t>(summary.m_failures.size());
+
+		if (summary.m_failures.size() > CorpusLoggedFailures) {
+			GA_LOG_WARNING("Skipped %u more MIDI files that couldn't be read", static_cast<uint32_t>(summary.m_failures.size()) - CorpusLoggedFailures);
+		}
+
+		// Windows for the old melodies alone would leave the new ones out of seeding
+		if (m_windowMeasures != 0 && summary.m_filesImported != 0) {
+			buildWindows(m_windowMeasures, m_windowSubdivision);
+		}
+
+		summary.m_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+		GA_LOG_INFO("Imported %u of %u MIDI files, %.2f MB and %llu notes in %.3f s (%.0f files/s)",
+			summary.m_filesImported, summary.m_filesRequested, static_cast<double>(summary.m_bytesRead) / (1024.0 * 1024.0),
+			static_cast<unsigned long long>(summary.m_notesRead), summary.m_seconds,
+			summary.m_seconds > 0.0 ? summary.m_filesRequested / summary.m_seconds : 0.0);
+
+		uint32_t imported = summary.m_filesImported;
+		if (stats) {
+			*stats = std::move(summary);
+		}
+
+		return imported;
+	}
+
+	void MelodyCorpus::clear() {
+
+		m_melodies.clear();
+		m_windows.clear();
+		m_windowMeasures = 0;
+		m_windowSubdivision = 0;
+	}
+
+	uint32_t MelodyCorpus::buildWindows(uint32_t measureCount, uint32_t subdivision) {
+
+		m_windows.clear();
+		m_windowMeasures = measureCount;
+		m_windowSubdivision = subdivision;
+
+		if (subdivision != MIDIHandler::MIDIMeasureSlots || measureCount == 0) {
+			return 0;
+		}
+
+		const uint32_t windowLength = measureCount * subdivision;
+
+		for (uint32_t melodyIndex = 0; melodyIndex < getMelodyCount(); ++melodyIndex) {
+
+			const CorpusMelody& melody = m_melodies[melodyIndex];
+			const uint32_t melodyLength = static_cast<uint32_t>(melody.m_rhythm.size());
+
+			for (uint32_t start = 0; start + windowLength <= melodyLength; start += subdivision) {
+
+				// Zero at a bar line means a note from the last measure is still being held
+				if (melody.m_rhythm[start] == 0) {
+					continue;
+				}
+
+				uint32_t end = start + windowLength;
+				uint32_t sounding = 0;
+
+				for (uint32_t slot = start; slot < end; slot += melody.m_rhythm[slot]) {
+					if (melody.m_pitches[slot] != 0) {
+						sounding += std::min<uint32_t>(melody.m_rhythm[slot], end - slot);
+					}
+				}
+
+				if (2 * sounding >= windowLength) {
+					m_windows.push_back({ melodyIndex, start });
+				}
+			}
+		}
+
+		return getWindowCount();
+	}
+
+	uint32_t MelodyCorpus::copyWindow(uint32_t window, Phrase* phrase) const {
+
+		const CorpusWindow& source = m_windows[window];
+		const CorpusMelody& melody = m_melodies[source.m_melody];
+
+		const char* pitches = melody.m_pitches.data() + source.m_start;
+		const char* rhythm = melody.m_rhythm.data() + source.m_start;
+
+		const uint32_t subdivision = m_windowSubdivision;
+		const uint32_t windowLength = m_windowMeasures * subdivision;
+
+		phrase->makeUnique();
+		std::memset(phrase->_melodicData, 0, windowLength);
+		std::memset(phrase->_melodicRhythm, 0, windowLength);
+
+		// Phrases in the population don't have rests (validatePhrase flags them), so each rest carries
+		// on the pitch before it. Rests before the first note take its pitch
+		char heldPitch = 0;
+		for (uint32_t slot = 0; slot < windowLength && heldPitch == 0; slot += rhythm[slot]) {
+			heldPitch = pitches[slot];
+		}
+
+		uint32_t noteCount = 0;
+		uint32_t slot = 0;
+
+		// The operators only understand measures built by halving notes, so every measure becomes the
+		// rhythm pattern nearest its onsets, the way the Markov model reads a corpus. Notes and rests
+		// held over a bar line sound again on it, rests inside a measure fold into the note before them
+		for (uint32_t barStart = 0; barStart < windowLength; barStart += subdivision) {
+
+			const uint32_t barEnd = barStart + subdivision;
+
+			char measurePitches[RhythmDictionary::MaxMeasureLength];
+			uint16_t onsetMask = 1;
+
+			while (slot < barEnd) {
+
+				uint32_t noteEnd = slot + rhythm[slot];
+				if (pitches[slot] != 0) {
+
+					heldPitch = pitches[slot];
+					if (slot >= barStart) {
+						onsetMask |= static_cast<uint16_t>(1u << (slot - barStart));
+					}
+				}
+
+				for (uint32_t held = std::max(slot, barStart); held < std::min(noteEnd, barEnd); ++held) {
+					measurePitches[held - barStart] = heldPitch;
+				}
+
+				// Read again for the next measure
+				if (noteEnd > barEnd) {
+					break;
+				}
+
+				slot = noteEnd;
+			}
+
+			uint16_t pattern = m_rhythmDictionary.findNearestPattern(onsetMask);
+			const char* patternRhythm = m_rhythmDictionary.getRhythm(pattern);
+
+			for (uint32_t onset = 0; onset < subdivision; ++onset) {
+
+				if (patternRhythm[onset] != 0) {
+
+					phrase->_melodicData[barStart + onset] = measurePitches[onset];
+					phrase->_melodicRhythm[barStart + onset] = patternRhythm[onset];
+					++noteCount;
+				}
+			}
+		}
+
+		phrase->_melodicNotes = noteCount;
+		return noteCount;
+	}
+
+	void MelodyCorpus::getWindowRange(uint32_t window, int& lowest, int& highest) const {
+
+		const CorpusWindow& source = m_windows[window];
+		const CorpusMelody& melody = m_melodies[source.m_melody];
+
+		const uint32_t end = source.m_start + m_windowMeasures * m_windowSubdivision;
+
+		lowest = 127;
+		highest = 0;
+
+		for (uint32_t slot = source.m_start; slot < end; slot += melody.m_rhythm[slot]) {
+
+			int pitch = melody.m_pitches[slot];
+			if (pitch != 0) {
+				lowest = std::min(lowest, pitch);
+				highest = std::max(highest, pitch);
+			}
+		}
+	}
+
+} // namespace Genetics
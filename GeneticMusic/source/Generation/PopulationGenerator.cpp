@@ -1,172 +1,424 @@
-/*
-** Author  - Morgen Hyde
-** Project - MusicGenetics
-** Date    - 10 / 21 / 2019
-*/
-
-#include "Generation/PopulationGenerator.h"
-#include "PhrasePool.h"
-#include "ChordDefinitions.h"
-
-#include <iostream>
-#include <iomanip>
-#include <random>
-
-namespace Genetics {
-
-	PopulationGenerator::PopulationGenerator(uint32_t populationSize, const PhraseConfig& heuristics)
-		: m_configuration(heuristics), m_populationSize(populationSize), 
-		  m_phraseAllocator(new PoolAllocator<Phrase>(2 * populationSize + 1)) {
-
-		std::random_device rd;
-		m_randomEngine.seed(rd());
-	}
-	
-	PopulationGenerator::~PopulationGenerator() {
-	}
-
-	void PopulationGenerator::resetAllocator(uint32_t newSize) {
-		
-		if (newSize != 0) {
-			m_populationSize = newSize;
-		}
-
-		delete m_phraseAllocator;
-		m_phraseAllocator = new PoolAllocator<Phrase>(2 * m_populationSize + 1);
-	}
-
-	unsigned PopulationGenerator::GetPopulationSize() const
-	{
-		return m_populationSize;
-	}
-
-	PhrasePool* PopulationGenerator::GeneratePopulation()
-	{
-		PhrasePool* newPhrasePool = new PhrasePool(m_phraseAllocator, 
-			m_configuration.numMeasures, m_configuration.smallestSubdivision);
-
-		Phrase::_numMeasures = m_configuration.numMeasures;
-		Phrase::_smallestSubdivision = m_configuration.smallestSubdivision;
-
-		for (unsigned i = 0; i < m_populationSize; ++i)
-		{
-			Phrase* newPhrase = newPhrasePool->AllocateChild();
-
-			// Logic for how to fill the phrase with actual notes goes here
-			unsigned phraseLen = m_configuration.numMeasures;
-			unsigned smallestSubDiv = m_configuration.smallestSubdivision;
-			
-			// Generate initial melody notes
-			generateMelodic(newPhrase, phraseLen, smallestSubDiv);
-
-			// Generate initial harmonic notes
-			generateHarmonic(newPhrase, phraseLen, smallestSubDiv);
-		}
-
-		newPhrasePool->MergeChildrenToPopulation<GenerationalPrune>();
-
-		return newPhrasePool;
-	}
-
-
-	void PopulationGenerator::generateMelodic(Phrase* phrase, unsigned numMeasures, unsigned subDiv)
-	{
-		// 1 - Generate Melodic Rhythm (use version of ddm from Langston paper)
-		
-		// First param is how many of whatever the smallest subdivision is we have per measure
-		// Second param is the multiplier we add to the density each recursive layer
-		// Third param is smallest subdivision we want to allow in the measure (as a integer number of the actual smallest)
-		// For example to get 4 4 with smallest allowed to be 16th notes, we have 16, something, 1 with the subDiv = 16
-		SubdivisionInfo subDivInfo = { static_cast<short>(subDiv), 1.55f, 1 };
-
-		unsigned int maxNotes = numMeasures * subDiv;
-
-		std::vector<char> phraseRhythm;
-		std::vector<char> measureRhythm;
-
-		// Reserve space for the literal worst rhythm to speed up push_back(s)
-		phraseRhythm.reserve(maxNotes);
-
-		for(unsigned i = 0; i < numMeasures; ++i)
-		{
-			subdivisionPattern(measureRhythm, subDivInfo, 0, 0.15f);
-
-			for (int j = 0; j < measureRhythm.size(); ++j) {
-			//	std::cout << static_cast<int>(measureRhythm[j]) << ", ";
-				phraseRhythm.push_back(measureRhythm[j]);
-			}
-			//std::cout << std::endl;
-
-			measureRhythm.clear();
-		}
-
-		size_t numNotes = phraseRhythm.size();
-
-		// 2 - Generate Melodic Pitches
-		// For now this is going to be a purely random distribution to see if the genetic algorithm can actually
-		// optimize out bad note sequences
-	
-		std::vector<char> melodicPitches;
-		melodicPitches.reserve(numNotes);
-
-		std::uniform_int_distribution<int> distrib(MinPitch, MaxPitch);
-		for (unsigned i = 0; i < numNotes; ++i) {
-			melodicPitches.push_back(distrib(m_randomEngine));
-		}
-
-		phrase->_melodicNotes = static_cast<unsigned>(numNotes);
-
-		// Loop over the notes and copy them into the phrase
-		for (unsigned index = 0, note = 0; index < maxNotes, note < numNotes; ++note) {
-
-			phrase->_melodicData[index] = melodicPitches[note];
-			phrase->_melodicRhythm[index] = phraseRhythm[note];
-
-			index += phraseRhythm[note];
-		}
-	}
-
-	void PopulationGenerator::generateHarmonic(Phrase* phrase, unsigned numMeasures, unsigned subDiv) {
-
-		// Temp Solution:
-
-		// Hardcoded harmonic progression that only moves every quarter notes
-		// First pass uses a basic I-IV-V-I
-
-		// Determine number of quarter notes so we know how many chords to generate
-		uint32_t numNotes = numMeasures * ChordRhythm;
-
-		phrase->_harmonicNotes = numNotes;
-
-		// Generate initial progression
-		for (uint32_t measure = 0; measure < numMeasures; ++measure) {
-
-			uint32_t idx = ChordRhythm * measure;
-
-			phrase->_harmonicData[idx + 0] = { ChordNumeral::I  }; // Defaults to Major
-			phrase->_harmonicData[idx + 1] = { ChordNumeral::IV };
-			phrase->_harmonicData[idx + 2] = { ChordNumeral::V  };
-			phrase->_harmonicData[idx + 3] = { ChordNumeral::I  };
-		}
-	}
-
-	void PopulationGenerator::subdivisionPattern(std::vector<char>& pattern, const SubdivisionInfo& info, short layer, float density)
-	{
-		// Calculate a number from 0 to 1
-		std::uniform_int_distribution<int> distrib(0, 100);
-		float probability = (float)(distrib(m_randomEngine)) / 100.0f; 
-
-		// If that number is larger than the density & we can subdivide further, 
-		// recurse down twice to subdivide the current note
-		if (probability > density && info.length >> layer > info.subDivMin) 
-		{
-			subdivisionPattern(pattern, info, layer + 1, density * info.layerMod);
-			subdivisionPattern(pattern, info, layer + 1, density * (info.layerMod + 0.2f));
-		}
-		else // If we didn't meet the condition to recurse down a layer then just add whatever our current size is
-		{
-			pattern.push_back(info.length >> layer);
-		}
-	}
-
+/*
+** Author  - Morgen Hyde
+** Project - MusicGenetics
+** Date    - 10 / 21 / 2019
+*/
+
+#include "Generation/PopulationGenerator.h"
+#include "Generation/MarkovModel.h"
+#include "PhrasePool.h"
+#include "ChordDefinitions.h"
+#include "Utility/TaskScheduler.h"
+#include "Utility/Profiler.h"
+#include "Utility/Logger.h"
+
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <algorithm> // std::upper_bound, std::min, std::max
+#include <cstring>   // std::memcpy
+
+namespace Genetics {
+
+	// Phrases drawn from each random stream when filling a new population, also the size of a task.
+	// Seeding a mersenne twister costs about as much as generating a short phrase, so the streams
+	// cover a run of phrases rather than one each
+	constexpr uint32_t GenerationStreamLength = 16;
+
+	// Rhythm generation (version of ddm from Langston paper), the density starts low so the first
+	// layers almost always subdivide and grows by the modifier every layer down
+	constexpr float RhythmLayerModifier = 1.55f;
+	constexpr float RhythmStartDensity = 0.15f;
+	constexpr short RhythmMinLength = 1;
+
+	PopulationGenerator::PopulationGenerator(uint32_t populationSize, const PhraseConfig& heuristics)
+		: m_configuration(heuristics), m_populationSize(populationSize), 
+		  m_phraseAllocator(new PoolAllocator<Phrase>(2 * populationSize + 1)), m_markovModel(nullptr) {
+
+		std::random_device rd;
+		m_randomEngine.seed(rd());
+
+		buildRhythmTable();
+	}
+	
+	PopulationGenerator::~PopulationGenerator() {
+	}
+
+	void PopulationGenerator::resetAllocator(uint32_t newSize) {
+		
+		if (newSize != 0) {
+			m_populationSize = newSize;
+		}
+
+		delete m_phraseAllocator;
+		m_phraseAllocator = new PoolAllocator<Phrase>(2 * m_populationSize + 1);
+	}
+
+	void PopulationGenerator::Seed(uint32_t seed) {
+
+		m_randomEngine.seed(seed);
+	}
+
+	void PopulationGenerator::SetConfiguration(const PhraseConfig& configuration) {
+
+		m_configuration = configuration;
+		buildRhythmTable();
+	}
+
+	unsigned PopulationGenerator::GetPopulationSize() const
+	{
+		return m_populationSize;
+	}
+
+	PhrasePool* PopulationGenerator::GeneratePopulation()
+	{
+		GA_PROFILE_SCOPE("GeneratePopulation");
+
+		PhrasePool* newPhrasePool = AllocatePopulation();
+
+		// The pool allocator isn't thread safe, so reserve every phrase up front
+		for (unsigned i = 0; i < m_populationSize; ++i)
+		{
+			newPhrasePool->AllocateChild();
+		}
+
+		// Corpus windows depend on the shape, they're only cut again when it changes
+		bool fromCorpus = false;
+		if (m_corpus.getMelodyCount() > 0) {
+
+			if (!m_corpus.hasWindowsFor(m_configuration.numMeasures, m_configuration.smallestSubdivision)) {
+
+				if (m_corpus.buildWindows(m_configuration.numMeasures, m_configuration.smallestSubdivision) == 0) {
+					GA_LOG_WARNING("The corpus has no %d measure windows at subdivision %d, generating random phrases", 
+								   m_configuration.numMeasures, m_configuration.smallestSubdivision);
+				}
+			}
+
+			fromCorpus = m_corpus.getWindowCount() > 0;
+		}
+
+		bool fromModel = false;
+		if (!fromCorpus && m_markovModel && m_markovModel->isReady()) {
+
+			fromModel = m_markovModel->getMeasureLength() == static_cast<uint32_t>(m_configuration.smallestSubdivision);
+			if (!fromModel) {
+				GA_LOG_WARNING("The model was trained on %u slot measures, generating random phrases at subdivision %d",
+							   m_markovModel->getMeasureLength(), m_configuration.smallestSubdivision);
+			}
+		}
+
+		const std::vector<Phrase*>& newPhrases = newPhrasePool->GetChildren();
+		unsigned phraseCount = static_cast<unsigned>(newPhrases.size());
+
+		// Along with a seed for every stream
+		unsigned streamCount = (phraseCount + GenerationStreamLength - 1) / GenerationStreamLength;
+
+		std::vector<uint32_t> streamSeeds(streamCount);
+		for (unsigned stream = 0; stream < streamCount; ++stream) {
+			streamSeeds[stream] = m_randomEngine();
+		}
+
+		// Then fill the phrases with notes in parallel, each stream is independent of the others
+		TaskScheduler::getScheduler().parallelFor(0, streamCount, 1, 
+			[this, &newPhrases, &streamSeeds, phraseCount, fromCorpus, fromModel](uint32_t firstStream, uint32_t lastStream) {
+
+			// Logic for how to fill the phrase with actual notes goes here
+			unsigned phraseLen = m_configuration.numMeasures;
+			unsigned smallestSubDiv = m_configuration.smallestSubdivision;
+
+			std::mt19937 streamEngine;
+			for (uint32_t stream = firstStream; stream < lastStream; ++stream) {
+
+				streamEngine.seed(streamSeeds[stream]);
+
+				uint32_t last = std::min((stream + 1) * GenerationStreamLength, phraseCount);
+				for (uint32_t i = stream * GenerationStreamLength; i < last; ++i) {
+
+					// Generate initial melody notes
+					if (fromCorpus) {
+						seedFromCorpus(newPhrases[i], streamEngine);
+					}
+					else if (fromModel) {
+						m_markovModel->generatePhrase(newPhrases[i], streamEngine);
+					}
+					else {
+						generateMelodic(newPhrases[i], phraseLen, smallestSubDiv, streamEngine);
+					}
+
+					// Generate initial harmonic notes
+					generateHarmonic(newPhrases[i], phraseLen, smallestSubDiv);
+				}
+			}
+		});
+
+		newPhrasePool->MergeChildrenToPopulation<GenerationalPrune>();
+
+		return newPhrasePool;
+	}
+
+
+	PhrasePool* PopulationGenerator::AllocatePopulation()
+	{
+		// The pool stamps its shape on every phrase it allocates
+		return new PhrasePool(m_phraseAllocator, m_configuration.numMeasures, m_configuration.smallestSubdivision);
+	}
+
+	uint32_t PopulationGenerator::LoadCorpus(const std::string& directory, CorpusImportStats* stats) {
+
+		return m_corpus.importDirectory(directory, stats);
+	}
+
+	void PopulationGenerator::ClearCorpus() {
+
+		m_corpus.clear();
+	}
+
+	void PopulationGenerator::seedFromCorpus(Phrase* phrase, std::mt19937& engine) {
+
+		std::uniform_int_distribution<uint32_t> windowDistrib(0, m_corpus.getWindowCount() - 1);
+		uint32_t window = windowDistrib(engine);
+
+		m_corpus.copyWindow(window, phrase);
+
+		// The whole window moves together so its intervals survive, as far as the pitch range allows
+		int lowest = 0;
+		int highest = 0;
+		m_corpus.getWindowRange(window, lowest, highest);
+
+		int down = std::max(-CorpusTransposeRange, static_cast<int>(MinPitch) - lowest);
+		int up = std::min(CorpusTransposeRange, static_cast<int>(MaxPitch) - highest);
+
+		int transpose = 0;
+		if (down <= up) {
+			std::uniform_int_distribution<int> transposeDistrib(down, up);
+			transpose = transposeDistrib(engine);
+		}
+
+		// Then a light mutation so copies of the same window don't start out identical
+		std::uniform_real_distribution<float> jitterChance(0.0f, 1.0f);
+		std::uniform_int_distribution<int> jitterDistrib(-2, 1);
+
+		const unsigned maxNotes = phrase->_numMeasures * phrase->_smallestSubdivision;
+		for (unsigned slot = 0; slot < maxNotes; slot += phrase->_melodicRhythm[slot]) {
+
+			int pitch = phrase->_melodicData[slot];
+			if (pitch == 0) {
+				continue;
+			}
+
+			pitch += transpose;
+			if (jitterChance(engine) < CorpusJitterChance) {
+
+				// -2 to 1 mapped onto -2, -1, 1, 2 so a jittered note always moves
+				int step = jitterDistrib(engine);
+				pitch += (step >= 0) ? step + 1 : step;
+			}
+
+			phrase->_melodicData[slot] = static_cast<char>(std::min(std::max(pitch, static_cast<int>(MinPitch)), static_cast<int>(MaxPitch)));
+		}
+	}
+
+	void PopulationGenerator::generateMelodic(Phrase* phrase, unsigned numMeasures, unsigned subDiv, std::mt19937& engine)
+	{
+		if (m_rhythmDictionary.getMeasureLength() != subDiv) {
+
+			generateMelodicRecursive(phrase, numMeasures, subDiv, engine);
+			return;
+		}
+
+		// Each measure's rhythm is one draw from the pattern table, copied straight over the grid.
+		// Pitches are still purely random to see if the genetic algorithm can actually optimize out
+		// bad note sequences, written on each onset as it's found
+		std::uniform_int_distribution<int> distrib(MinPitch, MaxPitch);
+
+		unsigned noteCount = 0;
+		for (unsigned measure = 0; measure < numMeasures; ++measure) {
+
+			uint16_t pattern = drawRhythmPattern(engine);
+
+			char* rhythm  = phrase->_melodicRhythm + measure * subDiv;
+			char* pitches = phrase->_melodicData + measure * subDiv;
+
+			std::memcpy(rhythm, m_rhythmDictionary.getRhythm(pattern), subDiv);
+			for (unsigned slot = 0; slot < subDiv; slot += rhythm[slot]) {
+				pitches[slot] = static_cast<char>(distrib(engine));
+			}
+
+			noteCount += m_rhythmDictionary.getNoteCount(pattern);
+		}
+
+		phrase->_melodicNotes = noteCount;
+	}
+
+	void PopulationGenerator::generateMelodicRecursive(Phrase* phrase, unsigned numMeasures, unsigned subDiv, std::mt19937& engine)
+	{
+		// 1 - Generate Melodic Rhythm (use version of ddm from Langston paper)
+		
+		// First param is how many of whatever the smallest subdivision is we have per measure
+		// Second param is the multiplier we add to the density each recursive layer
+		// Third param is smallest subdivision we want to allow in the measure (as a integer number of the actual smallest)
+		// For example to get 4 4 with smallest allowed to be 16th notes, we have 16, something, 1 with the subDiv = 16
+		SubdivisionInfo subDivInfo = { static_cast<short>(subDiv), RhythmLayerModifier, RhythmMinLength };
+
+		unsigned int maxNotes = numMeasures * subDiv;
+
+		std::vector<char> phraseRhythm;
+		std::vector<char> measureRhythm;
+
+		// Reserve space for the literal worst rhythm to speed up push_back(s)
+		phraseRhythm.reserve(maxNotes);
+
+		for(unsigned i = 0; i < numMeasures; ++i)
+		{
+			subdivisionPattern(measureRhythm, subDivInfo, 0, RhythmStartDensity, engine);
+
+			for (int j = 0; j < measureRhythm.size(); ++j) {
+			//	std::cout << static_cast<int>(measureRhythm[j]) << ", ";
+				phraseRhythm.push_back(measureRhythm[j]);
+			}
+			//std::cout << std::endl;
+
+			measureRhythm.clear();
+		}
+
+		size_t numNotes = phraseRhythm.size();
+
+		// 2 - Generate Melodic Pitches
+		// For now this is going to be a purely random distribution to see if the genetic algorithm can actually
+		// optimize out bad note sequences
+	
+		std::vector<char> melodicPitches;
+		melodicPitches.reserve(numNotes);
+
+		std::uniform_int_distribution<int> distrib(MinPitch, MaxPitch);
+		for (unsigned i = 0; i < numNotes; ++i) {
+			melodicPitches.push_back(distrib(engine));
+		}
+
+		phrase->_melodicNotes = static_cast<unsigned>(numNotes);
+
+		// Loop over the notes and copy them into the phrase
+		for (unsigned index = 0, note = 0; index < maxNotes, note < numNotes; ++note) {
+
+			phrase->_melodicData[index] = melodicPitches[note];
+			phrase->_melodicRhythm[index] = phraseRhythm[note];
+
+			index += phraseRhythm[note];
+		}
+	}
+
+	void PopulationGenerator::generateHarmonic(Phrase* phrase, unsigned numMeasures, unsigned subDiv) {
+
+		// Temp Solution:
+
+		// Hardcoded harmonic progression that only moves every quarter notes
+		// First pass uses a basic I-IV-V-I
+
+		// Determine number of quarter notes so we know how many chords to generate
+		uint32_t numNotes = numMeasures * ChordRhythm;
+
+		phrase->_harmonicNotes = numNotes;
+
+		// Generate initial progression
+		for (uint32_t measure = 0; measure < numMeasures; ++measure) {
+
+			uint32_t idx = ChordRhythm * measure;
+
+			phrase->_harmonicData[idx + 0] = { ChordNumeral::I  }; // Defaults to Major
+			phrase->_harmonicData[idx + 1] = { ChordNumeral::IV };
+			phrase->_harmonicData[idx + 2] = { ChordNumeral::V  };
+			phrase->_harmonicData[idx + 3] = { ChordNumeral::I  };
+		}
+	}
+
+	void PopulationGenerator::subdivisionPattern(std::vector<char>& pattern, const SubdivisionInfo& info, short layer, float density, std::mt19937& engine)
+	{
+		// Calculate a number from 0 to 1
+		std::uniform_int_distribution<int> distrib(0, 100);
+		float probability = (float)(distrib(engine)) / 100.0f; 
+
+		// If that number is larger than the density & we can subdivide further, 
+		// recurse down twice to subdivide the current note
+		if (probability > density && info.length >> layer > info.subDivMin) 
+		{
+			subdivisionPattern(pattern, info, layer + 1, density * info.layerMod, engine);
+			subdivisionPattern(pattern, info, layer + 1, density * (info.layerMod + 0.2f), engine);
+		}
+		else // If we didn't meet the condition to recurse down a layer then just add whatever our current size is
+		{
+			pattern.push_back(info.length >> layer);
+		}
+	}
+
+	void PopulationGenerator::subdivisionOdds(std::vector<std::pair<uint16_t, double>>& odds, const SubdivisionInfo& info, short layer, float density) const {
+
+		// subdivisionPattern splits when a roll of 0-100 over 100 beats the density, count the rolls that do
+		int splittingRolls = 0;
+		for (int roll = 0; roll <= 100; ++roll) {
+			splittingRolls += ((float)(roll) / 100.0f > density) ? 1 : 0;
+		}
+
+		short length = info.length >> layer;
+		double splitOdds = (length > info.subDivMin) ? splittingRolls / 101.0 : 0.0;
+
+		odds.clear();
+		odds.push_back({ 1, 1.0 - splitOdds });
+
+		if (splitOdds == 0.0) {
+			return;
+		}
+
+		std::vector<std::pair<uint16_t, double>> firstHalf;
+		std::vector<std::pair<uint16_t, double>> secondHalf;
+		subdivisionOdds(firstHalf, info, layer + 1, density * info.layerMod);
+		subdivisionOdds(secondHalf, info, layer + 1, density * (info.layerMod + 0.2f));
+
+		short half = length / 2;
+		for (const std::pair<uint16_t, double>& first : firstHalf) {
+			for (const std::pair<uint16_t, double>& second : secondHalf) {
+
+				uint16_t onsets = static_cast<uint16_t>(first.first | (second.first << half));
+				odds.push_back({ onsets, splitOdds * first.second * second.second });
+			}
+		}
+	}
+
+	void PopulationGenerator::buildRhythmTable() {
+
+		m_rhythmOdds.clear();
+
+		unsigned subDiv = m_configuration.smallestSubdivision;
+		if (!m_rhythmDictionary.build(subDiv, RhythmMinLength)) {
+			return;
+		}
+
+		SubdivisionInfo subDivInfo = { static_cast<short>(subDiv), RhythmLayerModifier, RhythmMinLength };
+
+		std::vector<std::pair<uint16_t, double>> odds;
+		subdivisionOdds(odds, subDivInfo, 0, RhythmStartDensity);
+
+		std::vector<double> patternOdds(m_rhythmDictionary.size(), 0.0);
+		for (const std::pair<uint16_t, double>& entry : odds) {
+			patternOdds[m_rhythmDictionary.findPattern(entry.first)] += entry.second;
+		}
+
+		m_rhythmOdds.resize(patternOdds.size());
+
+		double total = 0.0;
+		for (size_t pattern = 0; pattern < patternOdds.size(); ++pattern) {
+
+			total += patternOdds[pattern];
+			m_rhythmOdds[pattern] = total;
+		}
+	}
+
+	uint16_t PopulationGenerator::drawRhythmPattern(std::mt19937& engine) const {
+
+		std::uniform_real_distribution<double> distrib(0.0, m_rhythmOdds.back());
+		size_t pattern = std::upper_bound(m_rhythmOdds.begin(), m_rhythmOdds.end(), distrib(engine)) - m_rhythmOdds.begin();
+
+		// Patterns the recursion can't produce have no width, so the roll never lands on them
+		return static_cast<uint16_t>(std::min(pattern, m_rhythmOdds.size() - 1));
+	}
+
 } // namespace Genetics
\ No newline at end of file
@@ -0,0 +1,131 @@
+// Morgen Hyde
+
+#include "Generation/RhythmDictionary.h"
+#include "PhraseShape.h"
+
+#include <algorithm> // std::sort, std::lower_bound
+#include <cstring>   // std::memcmp
+
+namespace Genetics {
+
+	RhythmDictionary::RhythmDictionary()
+		: m_measureLength(0) {
+	}
+
+	RhythmDictionary::~RhythmDictionary() {
+	}
+
+	bool RhythmDictionary::supports(uint32_t measureLength) {
+
+		return measureLength != 0 && measureLength <= MaxMeasureLength && (measureLength & (measureLength - 1)) == 0;
+	}
+
+	bool RhythmDictionary::build(uint32_t measureLength, uint32_t minLength) {
+
+		m_onsetMasks.clear();
+		m_noteCounts.clear();
+		m_rhythms.clear();
+		m_measureLength = 0;
+
+		if (!supports(measureLength)) {
+			return false;
+		}
+
+		m_measureLength = measureLength;
+		enumerate(measureLength, std::max(minLength, 1u), m_onsetMasks);
+		std::sort(m_onsetMasks.begin(), m_onsetMasks.end());
+
+		// Expand every mask into its grid form once, a note runs until the next onset or the bar line
+		m_noteCounts.resize(m_onsetMasks.size());
+		m_rhythms.assign(m_onsetMasks.size() * measureLength, 0);
+
+		for (size_t pattern = 0; pattern < m_onsetMasks.size(); ++pattern) {
+
+			uint32_t onsets = m_onsetMasks[pattern];
+			char* rhythm = m_rhythms.data() + pattern * measureLength;
+
+			m_noteCounts[pattern] = static_cast<uint8_t>(countBits(onsets));
+
+			while (onsets != 0) {
+
+				uint32_t slot = lowestBit(onsets);
+				onsets &= onsets - 1;
+
+				uint32_t next = (onsets != 0) ? lowestBit(onsets) : measureLength;
+				rhythm[slot] = static_cast<char>(next - slot);
+			}
+		}
+
+		return true;
+	}
+
+	uint16_t RhythmDictionary::findPattern(uint16_t onsetMask) const {
+
+		std::vector<uint16_t>::const_iterator found = std::lower_bound(m_onsetMasks.begin(), m_onsetMasks.end(), onsetMask);
+		if (found == m_onsetMasks.end() || *found != onsetMask) {
+			return InvalidRhythmPattern;
+		}
+
+		return static_cast<uint16_t>(found - m_onsetMasks.begin());
+	}
+
+	uint16_t RhythmDictionary::findPattern(const char* measureRhythm) const {
+
+		if (m_measureLength == 0) {
+			return InvalidRhythmPattern;
+		}
+
+		uint16_t pattern = findPattern(static_cast<uint16_t>(noteMask(measureRhythm, m_measureLength)));
+
+		// The onsets only pick the candidate, the lengths still have to agree with it
+		if (pattern == InvalidRhythmPattern || std::memcmp(getRhythm(pattern), measureRhythm, m_measureLength) != 0) {
+			return InvalidRhythmPattern;
+		}
+
+		return pattern;
+	}
+
+	uint16_t RhythmDictionary::findNearestPattern(uint16_t onsetMask) const {
+
+		uint16_t pattern = findPattern(onsetMask);
+		if (pattern != InvalidRhythmPattern || m_onsetMasks.empty()) {
+			return pattern;
+		}
+
+		uint32_t bestDistance = MaxMeasureLength + 1;
+		for (size_t candidate = 0; candidate < m_onsetMasks.size(); ++candidate) {
+
+			uint32_t distance = countBits(static_cast<uint32_t>(m_onsetMasks[candidate] ^ onsetMask));
+			if (distance < bestDistance) {
+
+				bestDistance = distance;
+				pattern = static_cast<uint16_t>(candidate);
+			}
+		}
+
+		return pattern;
+	}
+
+	void RhythmDictionary::enumerate(uint32_t length, uint32_t minLength, std::vector<uint16_t>& masks) const {
+
+		// A single note covering the whole span
+		masks.push_back(1);
+
+		if (length <= minLength) {
+			return;
+		}
+
+		// Or any pattern for the first half followed by any pattern for the second
+		uint32_t half = length / 2;
+
+		std::vector<uint16_t> halves;
+		enumerate(half, minLength, halves);
+
+		for (uint16_t first : halves) {
+			for (uint16_t second : halves) {
+				masks.push_back(static_cast<uint16_t>(first | (second << half)));
+			}
+		}
+	}
+
+} // namespace Genetics
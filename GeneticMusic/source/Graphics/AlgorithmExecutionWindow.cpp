@@ -1,96 +1,201 @@
-// Morgen Hyde
-
-#include "Graphics/AlgorithmExecutionWindow.h"
-#include "GAControllerInterfaces.h"
-#include "GADefaultConfig.h"
-
-#include "imgui/imgui.h"
-
-#include <cstdint>
-#include <string>
-
-namespace Genetics {
-
-	AlgorithmExecutionWindow::AlgorithmExecutionWindow(std::unique_ptr<AlgorithmExecutionInterface> _interface)
-		: m_interface(std::move(_interface)) {
-
-	}
-
-	AlgorithmExecutionWindow::~AlgorithmExecutionWindow() {
-
-	}
-
-	uint16_t ValidSubdivisions[] = { 1, 2, 4, 8, 16 };
-
-	enum subdivions {
-		enm_whole = 0,
-		enm_half,
-		enm_quarter,
-		enm_eighth,
-		enm_sixteenth,
-		enm_max,
-	};
-
-	void renderDropDown(int& currentElement, const std::string& label) {
-
-		uint16_t previewElem = ValidSubdivisions[currentElement];
-		ImGui::Text(label.c_str());
-		if (ImGui::BeginCombo("##l", std::to_string(previewElem).c_str())) {
-
-			int numTypes = static_cast<int>(sizeof(ValidSubdivisions) / sizeof(uint16_t));
-			for (int i = 0; i < numTypes; ++i) {
-
-				uint16_t elem = ValidSubdivisions[i];
-				bool currSelected = (i == currentElement);
-				if (ImGui::Selectable(std::to_string(elem).c_str(), &currSelected)) {
-					currentElement = i;
-				}
-			}
-			ImGui::EndCombo();
-		}
-	}
-
-	void AlgorithmExecutionWindow::render() {
-
-		// For this window we need the following:
-
-		ImVec2 buttonDim(ImGui::GetContentRegionAvail().x, 0.0f);
-
-		// Start execution button
-		if (ImGui::Button("Run", buttonDim)) {
-
-			// NOTE: This will likely block and cause some issues since everything is single-threaded
-			m_interface->m_runAlgorithm();
-		}
-
-		ImGui::PushItemWidth(buttonDim.x);
-
-		// Integer input for number of generations
-		static int numGenerations = DefaultGenCount;
-		ImGui::Text("Generation Count");
-		ImGui::Separator();
-		if (ImGui::InputInt("##G", &numGenerations, 1, 100, ImGuiInputTextFlags_EnterReturnsTrue)) {
-
-			m_interface->m_setIterationCount(static_cast<uint32_t>(numGenerations));
-		}
-
-		static int populationSize = DefaultPopulationSize;
-		ImGui::Text("Population Size");
-		ImGui::Separator();
-		if (ImGui::InputInt("##P", &populationSize, 1, 100, ImGuiInputTextFlags_EnterReturnsTrue)) {
-
-			m_interface->m_setPopulationSize(static_cast<uint32_t>(populationSize));
-		}
-
-		ImGui::NewLine();
-
-		if (ImGui::Button("Reset Population", buttonDim)) {
-
-			m_interface->m_clearPhrasePool();
-		}
-
-		ImGui::PopItemWidth();
-	}
-
-
+// Morgen Hyde
+
+#include "Graphics/AlgorithmExecutionWindow.h"
+#include "GAControllerInterfaces.h"
+#include "GADefaultConfig.h"
+
+#include "imgui/imgui.h"
+
+#include <cstdint>
+#include <string>
+
+namespace Genetics {
+
+	AlgorithmExecutionWindow::AlgorithmExecutionWindow(std::unique_ptr<AlgorithmExecutionInterface> _interface)
+		: m_interface(std::move(_interface)) {
+
+	}
+
+	AlgorithmExecutionWindow::~AlgorithmExecutionWindow() {
+
+	}
+
+	uint16_t ValidSubdivisions[] = { 1, 2, 4, 8, 16 };
+
+	enum subdivions {
+		enm_whole = 0,
+		enm_half,
+		enm_quarter,
+		enm_eighth,
+		enm_sixteenth,
+		enm_max,
+	};
+
+	void renderDropDown(int& currentElement, const std::string& label) {
+
+		uint16_t previewElem = ValidSubdivisions[currentElement];
+		ImGui::Text(label.c_str());
+		if (ImGui::BeginCombo("##l", std::to_string(previewElem).c_str())) {
+
+			int numTypes = static_cast<int>(sizeof(ValidSubdivisions) / sizeof(uint16_t));
+			for (int i = 0; i < numTypes; ++i) {
+
+				uint16_t elem = ValidSubdivisions[i];
+				bool currSelected = (i == currentElement);
+				if (ImGui::Selectable(std::to_string(elem).c_str(), &currSelected)) {
+					currentElement = i;
+				}
+			}
+			ImGui::EndCombo();
+		}
+	}
+
+	void AlgorithmExecutionWindow::render() {
+
+		// For this window we need the following:
+
+		ImVec2 buttonDim(ImGui::GetContentRegionAvail().x, 0.0f);
+
+		// Start execution button
+		if (ImGui::Button("Run", buttonDim)) {
+
+			// NOTE: This will likely block and cause some issues since everything is single-threaded
+			m_interface->m_runAlgorithm();
+		}
+
+		ImGui::PushItemWidth(buttonDim.x);
+
+		// Integer input for number of generations
+		static int numGenerations = DefaultGenCount;
+		ImGui::Text("Generation Count");
+		ImGui::Separator();
+		if (ImGui::InputInt("##G", &numGenerations, 1, 100, ImGuiInputTextFlags_EnterReturnsTrue)) {
+
+			m_interface->m_setIterationCount(static_cast<uint32_t>(numGenerations));
+		}
+
+		static int timeBudget = DefaultTimeBudgetMs;
+		ImGui::Text("Time Budget ms (0 = Off)");
+		ImGui::Separator();
+		if (ImGui::InputInt("##T", &timeBudget, 50, 500, ImGuiInputTextFlags_EnterReturnsTrue)) {
+
+			timeBudget = (timeBudget < 0) ? 0 : timeBudget;
+			m_interface->m_setTimeBudget(static_cast<uint32_t>(timeBudget));
+		}
+
+		static int populationSize = DefaultPopulationSize;
+		ImGui::Text("Population Size");
+		ImGui::Separator();
+		if (ImGui::InputInt("##P", &populationSize, 1, 100, ImGuiInputTextFlags_EnterReturnsTrue)) {
+
+			m_interface->m_setPopulationSize(static_cast<uint32_t>(populationSize));
+		}
+
+		static int workerCount = DefaultWorkerCount;
+		ImGui::Text("Worker Threads (0 = Auto)");
+		ImGui::Separator();
+		if (ImGui::InputInt("##W", &workerCount, 1, 4, ImGuiInputTextFlags_EnterReturnsTrue)) {
+
+			workerCount = (workerCount < 0) ? 0 : workerCount;
+			m_interface->m_setWorkerCount(static_cast<uint32_t>(workerCount));
+		}
+
+		static bool pinWorkers = DefaultPinWorkers;
+		if (ImGui::Checkbox("Pin Workers To Cores", &pinWorkers)) {
+
+			m_interface->m_setWorkerPinning(pinWorkers);
+		}
+
+		static bool steadyState = DefaultSteadyState;
+		if (ImGui::Checkbox("Steady State Replacement", &steadyState)) {
+
+			m_interface->m_setSteadyState(steadyState);
+		}
+
+		static bool stopOnConvergence = DefaultConvergenceCriteria.m_enabled;
+		if (ImGui::Checkbox("Stop When Converged", &stopOnConvergence)) {
+
+			m_interface->m_setStopOnConvergence(stopOnConvergence);
+		}
+
+		if (stopOnConvergence) {
+
+			static int plateauGenerations = DefaultConvergenceCriteria.m_plateauGenerations;
+			ImGui::Text("Plateau Generations");
+			ImGui::Separator();
+			if (ImGui::InputInt("##C", &plateauGenerations, 1, 10, ImGuiInputTextFlags_EnterReturnsTrue)) {
+
+				plateauGenerations = (plateauGenerations < 1) ? 1 : plateauGenerations;
+				m_interface->m_setPlateauGenerations(static_cast<uint32_t>(plateauGenerations));
+			}
+		}
+
+		ImGui::NewLine();
+
+		if (ImGui::Button("Reset Population", buttonDim)) {
+
+			m_interface->m_clearPhrasePool();
+		}
+
+		// Telemetry goes to Output// as CSV by default, any other extension writes the binary format
+		static char telemetryFile[48] = "Telemetry.csv";
+		ImGui::Text("Telemetry File");
+		ImGui::Separator();
+		ImGui::InputText("##E", telemetryFile, sizeof(telemetryFile));
+
+		if (ImGui::Button("Export Telemetry", buttonDim)) {
+
+			m_interface->m_exportTelemetry("Output//" + std::string(telemetryFile));
+		}
+
+		static char checkpointFile[48] = "Population.gmcp";
+		ImGui::Text("Checkpoint File");
+		ImGui::Separator();
+		ImGui::InputText("##K", checkpointFile, sizeof(checkpointFile));
+
+		if (ImGui::Button("Save Checkpoint", buttonDim)) {
+
+			m_interface->m_saveCheckpoint("Output//" + std::string(checkpointFile));
+		}
+
+		if (ImGui::Button("Load Checkpoint", buttonDim)) {
+
+			m_interface->m_loadCheckpoint("Output//" + std::string(checkpointFile));
+		}
+
+#ifdef GA_ENABLE_PROFILING
+		static bool profiling = false;
+		if (ImGui::Checkbox("Capture Profile", &profiling)) {
+
+			m_interface->m_setProfiling(profiling);
+		}
+
+		if (ImGui::Button("Export Chrome Trace", buttonDim)) {
+
+			m_interface->m_exportTrace("Output//Trace.json");
+		}
+#endif
+
+		ImGui::NewLine();
+
+		// Memory use of the tracked subsystems, useful for sizing the population against RAM
+		ImGui::Text("Memory (current / peak MB)");
+		ImGui::Separator();
+
+		const float BytesPerMB = 1024.0f * 1024.0f;
+		uint64_t totalBytes = 0;
+		for (int tag = 0; tag < mem_Count; ++tag) {
+
+			MemoryTagStats stats = m_interface->m_readMemoryStats(static_cast<MemoryTag>(tag));
+			totalBytes += stats.m_currentBytes;
+
+			ImGui::Text("%-15s %8.2f / %8.2f", getMemoryTagName(static_cast<MemoryTag>(tag)),
+			            stats.m_currentBytes / BytesPerMB, stats.m_peakBytes / BytesPerMB);
+		}
+		ImGui::Text("%-15s %8.2f", "Total", totalBytes / BytesPerMB);
+
+		ImGui::PopItemWidth();
+	}
+
+
 } // namespace Genetics
\ No newline at end of file
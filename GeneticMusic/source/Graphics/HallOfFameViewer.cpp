@@ -0,0 +1,105 @@
+// Morgen Hyde
+
+#include "Graphics/HallOfFameViewer.h"
+#include "GAControllerInterfaces.h"
+#include "Phrase.h"
+
+#include "imgui/imgui.h"
+#include "Graphics/ImGuiHelpers.h"
+
+#include <string>
+
+namespace Genetics {
+
+	HallOfFameViewer::HallOfFameViewer(std::unique_ptr<HallOfFameInterface> _interface)
+		: m_interface(std::move(_interface)) {
+
+	}
+
+	HallOfFameViewer::~HallOfFameViewer() {
+
+	}
+
+	void HallOfFameViewer::render() {
+
+		// Archived copies, reading these never touches the live population
+		const std::vector<Phrase*>& archive = m_interface->m_readHallOfFame();
+
+		ImGui::Text("Best Phrases So Far: %d", static_cast<int>(archive.size()));
+
+		if (ImGui::Button("Clear Hall Of Fame")) {
+
+			m_interface->m_clearHallOfFame();
+			return;
+		}
+
+		ImGui::Separator();
+
+		ImVec2 buttonDim(ImGui::GetContentRegionAvail().x, 0.0f);
+
+		ImGui::BeginChild("HallOfFameScrolling");
+		uint32_t rank = 1;
+		for (Phrase* phrase : archive) {
+
+			std::string entryText("#");
+			entryText += std::to_string(rank);
+			entryText += "  Phrase ID: ";
+			entryText += std::to_string(phrase->_phraseID);
+			entryText += "\nFitness Score: ";
+
+			std::string scoreString = std::to_string(phrase->_fitnessValue);
+			entryText += scoreString.substr(0, 4);
+
+			ImGui::PushID(rank);
+
+			ImGui::Button(entryText.c_str(), buttonDim);
+
+			bool openExport = false;
+			if (ImGui::BeginPopupContextItem("IO Dialog", 1)) {
+
+				if (ImGui::MenuItem("Export MIDI")) { openExport = true; }
+
+				ImGui::EndPopup();
+			}
+
+			if (openExport) {
+
+				ImGui::OpenPopup("Export Dialog");
+				ImGui::SetNextWindowSize(ImGui::GetMainViewport()->Size * 0.33f);
+			}
+
+			if (ImGui::BeginPopupModal("Export Dialog")) {
+
+				static char exportPath[48] = "HallOfFame";
+
+				bool enterHit = ImGui::InputText("FileName", exportPath, sizeof(exportPath), ImGuiInputTextFlags_EnterReturnsTrue);
+
+				if (enterHit || ImGui::Button("Export", ImVec2(-1, 0))) {
+
+					std::string toSave(exportPath);
+					toSave.append(".midi");
+
+					// Only the fitness and ID stay in memory for spilled entries, page the notes back in
+					Phrase* resident = m_interface->m_loadArchivedPhrase(rank - 1);
+					if (resident) {
+						m_interface->m_exportMIDI("Output//" + toSave, resident);
+					}
+
+					ImGui::CloseCurrentPopup();
+				}
+
+				if (ImGui::Button("Cancel", ImVec2(-1, 0))) {
+
+					ImGui::CloseCurrentPopup();
+				}
+
+				ImGui::EndPopup();
+			}
+
+			ImGui::PopID();
+			++rank;
+		}
+		ImGui::EndChild();
+	}
+
+} // namespace Genetics
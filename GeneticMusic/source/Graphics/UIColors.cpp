@@ -1,32 +1,32 @@
-
-#include "imgui/imgui.h"
-
-ImU32 whiteKey = IM_COL32_WHITE;
-ImU32 blackKey = IM_COL32_BLACK;
-ImU32 keyBorder = IM_COL32(120, 120, 120, 255);
-
-ImU32 blackBackground = IM_COL32(57, 57, 70, 255);
-ImU32 background = IM_COL32(98, 98, 119, 255);
-ImU32 gridLines = IM_COL32(17, 28, 110, 255);
-
-ImU32 timelineBackground = IM_COL32(71, 71, 107, 255);
-ImU32 timelineColor = IM_COL32(255, 140, 26, 255);
-ImU32 timelineNotchText = IM_COL32_BLACK;
-
-ImU32 noteColor = IM_COL32(255, 100, 100, 255);
-ImU32 chordColor = IM_COL32(100, 149, 237, 255);
-ImU32 noteBorderColor = IM_COL32_BLACK;
-ImU32 noteLineColor = IM_COL32_WHITE;
-
-ImU32 ScrollBackground = IM_COL32(80, 93, 98, 255);
-ImU32 ScrollTrough = IM_COL32(103, 120, 126, 255);
-ImU32 ScrollBar = IM_COL32(173, 45, 0, 255);
-
-// Editor Colors
-ImU32 backgroundColor = IM_COL32(32, 32, 32, 255);
-ImU32 axisColor = IM_COL32(204, 204, 204, 255);
-ImU32 gridLineColor = IM_COL32(76, 76, 76, 255);
-ImU32 vertexColor = IM_COL32(200, 200, 0, 255);
-ImU32 segmentColor = IM_COL32(76, 0, 153, 255);
-
-ImU32 graphLabelColor = IM_COL32_WHITE;
+
+#include "imgui/imgui.h"
+
+ImU32 whiteKey = IM_COL32_WHITE;
+ImU32 blackKey = IM_COL32_BLACK;
+ImU32 keyBorder = IM_COL32(120, 120, 120, 255);
+
+ImU32 blackBackground = IM_COL32(57, 57, 70, 255);
+ImU32 background = IM_COL32(98, 98, 119, 255);
+ImU32 gridLines = IM_COL32(17, 28, 110, 255);
+
+ImU32 timelineBackground = IM_COL32(71, 71, 107, 255);
+ImU32 timelineColor = IM_COL32(255, 140, 26, 255);
+ImU32 timelineNotchText = IM_COL32_BLACK;
+
+ImU32 noteColor = IM_COL32(255, 100, 100, 255);
+ImU32 chordColor = IM_COL32(100, 149, 237, 255);
+ImU32 noteBorderColor = IM_COL32_BLACK;
+ImU32 noteLineColor = IM_COL32_WHITE;
+
+ImU32 ScrollBackground = IM_COL32(80, 93, 98, 255);
+ImU32 ScrollTrough = IM_COL32(103, 120, 126, 255);
+ImU32 ScrollBar = IM_COL32(173, 45, 0, 255);
+
+// Editor Colors
+ImU32 backgroundColor = IM_COL32(32, 32, 32, 255);
+ImU32 axisColor = IM_COL32(204, 204, 204, 255);
+ImU32 gridLineColor = IM_COL32(76, 76, 76, 255);
+ImU32 vertexColor = IM_COL32(200, 200, 0, 255);
+ImU32 segmentColor = IM_COL32(76, 0, 153, 255);
+
+ImU32 graphLabelColor = IM_COL32_WHITE;
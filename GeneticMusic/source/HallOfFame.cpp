@@ -0,0 +1,304 @@
+// Morgen Hyde
+
+#include "HallOfFame.h"
+#include "Phrase.h"
+#include "PhrasePool.h" // PhraseFitnessSorter
+#include "Utility/PhraseHash.h"
+#include "Utility/Logger.h"
+
+#include <algorithm> // std::push_heap, std::pop_heap
+#include <limits>    // std::numeric_limits
+#include <iterator>  // std::prev
+
+namespace Genetics {
+
+	// std heap functions build a max-heap, invert so the weakest entry sits on top
+	struct ArchiveEntryCompare {
+
+		template <typename Entry>
+		bool operator()(const Entry& lhs, const Entry& rhs) const {
+
+			return lhs.m_phrase->_fitnessValue > rhs.m_phrase->_fitnessValue;
+		}
+	};
+
+	HallOfFame::HallOfFame(uint32_t capacity)
+		: m_sortedDirty(false), m_capacity(capacity), m_memoryBudget(0), m_residentBytes(0) {
+
+		m_heap.reserve(capacity);
+		m_genomeHashes.reserve(capacity);
+	}
+
+	HallOfFame::~HallOfFame() {
+
+		// The spill file goes with the archive, no point starting it over
+		m_memoryBudget = 0;
+		clear();
+	}
+
+	bool HallOfFame::offer(const Phrase* phrase) {
+
+		if (!phrase || m_capacity == 0) {
+			return false;
+		}
+
+		// Cheap reject before hashing, most children never come close once the archive fills up
+		bool full = (m_heap.size() >= m_capacity);
+		if (full && phrase->_fitnessValue <= m_heap.front().m_phrase->_fitnessValue) {
+			return false;
+		}
+
+		uint64_t genomeHash = hashPhraseGenome(phrase);
+		if (m_genomeHashes.count(genomeHash)) {
+			return false;
+		}
+
+		if (full) {
+			evictWeakest();
+		}
+
+		// Shares the child's arrays until one side writes to them, copies keep the original ID so
+		// the archive can be matched up with the population
+		Phrase* archived = new Phrase(*phrase);
+
+		m_heap.push_back({ archived, genomeHash });
+		std::push_heap(m_heap.begin(), m_heap.end(), ArchiveEntryCompare());
+		m_genomeHashes.insert(genomeHash);
+
+		if (m_memoryBudget) {
+
+			trackResident(archived);
+			enforceBudget(archived);
+		}
+
+		m_sortedDirty = true;
+		return true;
+	}
+
+	void HallOfFame::offerAll(const std::vector<Phrase*>& phrases) {
+
+		for (const Phrase* phrase : phrases) {
+			offer(phrase);
+		}
+	}
+
+	void HallOfFame::clear() {
+
+		for (ArchiveEntry& entry : m_heap) {
+			delete entry.m_phrase;
+		}
+
+		m_heap.clear();
+		m_genomeHashes.clear();
+		m_sortedEntries.clear();
+		m_sortedDirty = false;
+
+		m_residentOrder.clear();
+		m_residency.clear();
+		m_residentBytes = 0;
+
+		// Nothing in the spill file is referenced anymore, start it over
+		if (m_memoryBudget) {
+			m_spillFile.open(m_spillPath);
+		}
+	}
+
+	void HallOfFame::setCapacity(uint32_t capacity) {
+
+		m_capacity = capacity;
+		while (m_heap.size() > m_capacity) {
+			evictWeakest();
+		}
+
+		m_sortedDirty = true;
+	}
+
+	const std::vector<Phrase*>& HallOfFame::getEntries() const {
+
+		if (m_sortedDirty) {
+
+			m_sortedEntries.clear();
+			for (const ArchiveEntry& entry : m_heap) {
+				m_sortedEntries.push_back(entry.m_phrase);
+			}
+
+			std::sort(m_sortedEntries.begin(), m_sortedEntries.end(), PhraseFitnessSorter());
+			m_sortedDirty = false;
+		}
+
+		return m_sortedEntries;
+	}
+
+	bool HallOfFame::setMemoryBudget(size_t residentBytes, const std::string& spillPath) {
+
+		// Bring every entry back first, the spill file is started over below
+		if (m_memoryBudget) {
+
+			for (ArchiveEntry& entry : m_heap) {
+				pageIn(entry.m_phrase);
+			}
+		}
+
+		m_residentOrder.clear();
+		m_residency.clear();
+		m_residentBytes = 0;
+		m_spillFile.close();
+
+		m_memoryBudget = residentBytes;
+		m_spillPath = spillPath;
+
+		if (m_memoryBudget == 0) {
+			return true;
+		}
+
+		if (!m_spillFile.open(m_spillPath)) {
+
+			m_memoryBudget = 0;
+			return false;
+		}
+
+		for (ArchiveEntry& entry : m_heap) {
+			trackResident(entry.m_phrase);
+		}
+
+		enforceBudget(nullptr);
+		return true;
+	}
+
+	Phrase* HallOfFame::loadEntry(uint32_t rank) {
+
+		const std::vector<Phrase*>& entries = getEntries();
+		if (rank >= entries.size()) {
+			return nullptr;
+		}
+
+		Phrase* phrase = entries[rank];
+		if (m_memoryBudget) {
+
+			if (!pageIn(phrase)) {
+				return nullptr;
+			}
+
+			enforceBudget(phrase);
+		}
+
+		return phrase;
+	}
+
+	float HallOfFame::getAdmissionThreshold() const {
+
+		if (m_heap.size() < m_capacity || m_heap.empty()) {
+			return std::numeric_limits<float>::lowest();
+		}
+
+		return m_heap.front().m_phrase->_fitnessValue;
+	}
+
+	void HallOfFame::evictWeakest() {
+
+		std::pop_heap(m_heap.begin(), m_heap.end(), ArchiveEntryCompare());
+
+		ArchiveEntry& weakest = m_heap.back();
+		m_genomeHashes.erase(weakest.m_genomeHash);
+
+		if (m_memoryBudget) {
+			forget(weakest.m_phrase);
+		}
+		delete weakest.m_phrase;
+
+		m_heap.pop_back();
+		m_sortedDirty = true;
+	}
+
+	void HallOfFame::trackResident(Phrase* phrase) {
+
+		m_residentOrder.push_back(phrase);
+		m_residency[phrase] = { InvalidSpillOffset, true, std::prev(m_residentOrder.end()) };
+
+		m_residentBytes += phrase->_arrayBytes;
+	}
+
+	void HallOfFame::forget(Phrase* phrase) {
+
+		auto found = m_residency.find(phrase);
+		if (found == m_residency.end()) {
+			return;
+		}
+
+		// The record stays in the file, it's append only and gets reclaimed when the archive is cleared
+		if (found->second.m_resident) {
+
+			m_residentOrder.erase(found->second.m_lruPosition);
+			m_residentBytes -= phrase->_arrayBytes;
+		}
+
+		m_residency.erase(found);
+	}
+
+	bool HallOfFame::spill(Phrase* phrase) {
+
+		Residency& residency = m_residency[phrase];
+
+		// Archived entries never change, so once written the record can be reused every time
+		if (residency.m_spillOffset == InvalidSpillOffset) {
+
+			// Turned away if it's a different shape from what's already in the file
+			residency.m_spillOffset = m_spillFile.append(phrase);
+			if (residency.m_spillOffset == InvalidSpillOffset) {
+				return false;
+			}
+		}
+
+		m_residentOrder.erase(residency.m_lruPosition);
+		m_residentBytes -= phrase->_arrayBytes;
+		residency.m_resident = false;
+
+		phrase->releaseArrays();
+		return true;
+	}
+
+	bool HallOfFame::pageIn(Phrase* phrase) {
+
+		Residency& residency = m_residency[phrase];
+
+		// Already resident, just mark it as the most recently used
+		if (residency.m_resident) {
+
+			m_residentOrder.splice(m_residentOrder.end(), m_residentOrder, residency.m_lruPosition);
+			return true;
+		}
+
+		// Spilled phrases keep their shape, so the arrays come back the same size they left
+		phrase->allocateArrays(phrase->_numMeasures, phrase->_smallestSubdivision);
+		if (!m_spillFile.read(residency.m_spillOffset, phrase)) {
+
+			GA_LOG_ERROR("Unable to page phrase %u back in from %s", phrase->_phraseID, m_spillPath.c_str());
+			phrase->releaseArrays();
+			return false;
+		}
+
+		m_residentOrder.push_back(phrase);
+		residency.m_lruPosition = std::prev(m_residentOrder.end());
+		residency.m_resident = true;
+
+		m_residentBytes += phrase->_arrayBytes;
+		return true;
+	}
+
+	void HallOfFame::enforceBudget(const Phrase* keep) {
+
+		std::list<Phrase*>::iterator candidate = m_residentOrder.begin();
+		while (m_residentBytes > m_memoryBudget && candidate != m_residentOrder.end()) {
+
+			// Step past it first, spilling takes it out of the list
+			Phrase* phrase = *candidate;
+			++candidate;
+
+			// Entries that can't be spilled just stay resident over budget
+			if (phrase != keep) {
+				spill(phrase);
+			}
+		}
+	}
+
+} // namespace Genetics
@@ -0,0 +1,294 @@
+// Morgen Hyde
+
+#include "HeadlessRunner.h"
+#include "GAController.h"
+#include "GADefaultConfig.h"
+#include "Phrase.h"
+
+#include "Fitness/RuleManager.h"
+#include "Utility/Profiler.h"
+#include "Utility/MemoryTracker.h"
+
+#include <iostream> // std::cout
+#include <cstring>  // std::strcmp
+#include <cstdlib>  // std::strtoul
+
+namespace Genetics {
+
+	HeadlessOptions::HeadlessOptions()
+		: m_headless(false), m_steadyState(DefaultSteadyState), m_packedPopulation(DefaultPackedPopulation), m_fixedCheckpoint(DefaultFixedCheckpointRecords), m_stopOnConvergence(DefaultConvergenceCriteria.m_enabled),
+		  m_useSeed(false), m_quarantine(DefaultIntegritySettings.m_quarantine), m_generations(DefaultGenCount), m_hallOfFameSize(DefaultHallOfFameSize),
+		  m_plateauGenerations(DefaultConvergenceCriteria.m_plateauGenerations), m_timeBudgetMs(DefaultTimeBudgetMs), m_seed(0),
+		  m_checkInterval(DefaultIntegritySettings.m_sampleInterval), m_archiveBudgetKB(DefaultArchiveBudgetBytes / 1024),
+		  m_spillPath(DefaultArchiveSpillPath) {
+	}
+
+	void printUsage() {
+
+		std::cout << "Usage: GeneticMusic [--headless] [--generations N] [--time-budget ms] [--steady-state]" << std::endl;
+		std::cout << "                    [--stop-on-convergence] [--plateau N] [--seed N]" << std::endl;
+		std::cout << "                    [--check-every N] [--no-quarantine] [--packed]" << std::endl;
+		std::cout << "                    [--hall-of-fame N] [--archive-budget KB] [--spill-file path]" << std::endl;
+		std::cout << "                    [--rules file.xml] [--corpus directory] [--export prefix]" << std::endl;
+		std::cout << "                    [--model directory|file.gmmk] [--save-model file.gmmk]" << std::endl;
+		std::cout << "                    [--telemetry file.csv|file.bin] [--trace file.json]" << std::endl;
+		std::cout << "                    [--resume file.gmcp] [--checkpoint file.gmcp] [--fixed-checkpoint]" << std::endl;
+	}
+
+	bool parseCommandLine(int argc, char** argv, HeadlessOptions& options) {
+
+		for (int i = 1; i < argc; ++i) {
+
+			const char* arg = argv[i];
+			bool hasValue = (i + 1 < argc);
+
+			if (std::strcmp(arg, "--headless") == 0) {
+				options.m_headless = true;
+			}
+			else if (std::strcmp(arg, "--steady-state") == 0) {
+				options.m_steadyState = true;
+			}
+			else if (std::strcmp(arg, "--packed") == 0) {
+				options.m_packedPopulation = true;
+			}
+			else if (std::strcmp(arg, "--stop-on-convergence") == 0) {
+				options.m_stopOnConvergence = true;
+			}
+			else if (std::strcmp(arg, "--plateau") == 0 && hasValue) {
+				options.m_plateauGenerations = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+			}
+			else if (std::strcmp(arg, "--generations") == 0 && hasValue) {
+				options.m_generations = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+			}
+			else if (std::strcmp(arg, "--time-budget") == 0 && hasValue) {
+				options.m_timeBudgetMs = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+			}
+			else if (std::strcmp(arg, "--seed") == 0 && hasValue) {
+				options.m_useSeed = true;
+				options.m_seed = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+			}
+			else if (std::strcmp(arg, "--check-every") == 0 && hasValue) {
+				options.m_checkInterval = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+			}
+			else if (std::strcmp(arg, "--no-quarantine") == 0) {
+				options.m_quarantine = false;
+			}
+			else if (std::strcmp(arg, "--hall-of-fame") == 0 && hasValue) {
+				options.m_hallOfFameSize = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+			}
+			else if (std::strcmp(arg, "--archive-budget") == 0 && hasValue) {
+				options.m_archiveBudgetKB = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+			}
+			else if (std::strcmp(arg, "--spill-file") == 0 && hasValue) {
+				options.m_spillPath = argv[++i];
+			}
+			else if (std::strcmp(arg, "--rules") == 0 && hasValue) {
+				options.m_rulesPath = argv[++i];
+			}
+			else if (std::strcmp(arg, "--corpus") == 0 && hasValue) {
+				options.m_corpusPath = argv[++i];
+			}
+			else if (std::strcmp(arg, "--model") == 0 && hasValue) {
+				options.m_modelPath = argv[++i];
+			}
+			else if (std::strcmp(arg, "--save-model") == 0 && hasValue) {
+				options.m_modelSavePath = argv[++i];
+			}
+			else if (std::strcmp(arg, "--export") == 0 && hasValue) {
+				options.m_exportPrefix = argv[++i];
+			}
+			else if (std::strcmp(arg, "--telemetry") == 0 && hasValue) {
+				options.m_telemetryPath = argv[++i];
+			}
+			else if (std::strcmp(arg, "--trace") == 0 && hasValue) {
+				options.m_tracePath = argv[++i];
+			}
+			else if (std::strcmp(arg, "--resume") == 0 && hasValue) {
+				options.m_resumePath = argv[++i];
+			}
+			else if (std::strcmp(arg, "--checkpoint") == 0 && hasValue) {
+				options.m_checkpointPath = argv[++i];
+			}
+			else if (std::strcmp(arg, "--fixed-checkpoint") == 0) {
+				options.m_fixedCheckpoint = true;
+			}
+			else {
+
+				std::cout << "Unrecognized argument: " << arg << std::endl;
+				printUsage();
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	int runHeadless(const HeadlessOptions& options) {
+
+		if (!options.m_rulesPath.empty()) {
+
+			if (!RuleManager::getRuleManager().importRules(options.m_rulesPath)) {
+
+				std::cout << "Failed to import rules from " << options.m_rulesPath << std::endl;
+				return 1;
+			}
+		}
+
+		GeneticAlgorithmController geneticAlgorithm;
+
+		geneticAlgorithm.setIterationCount(options.m_generations);
+		geneticAlgorithm.setTimeBudget(options.m_timeBudgetMs);
+		geneticAlgorithm.setSteadyState(options.m_steadyState);
+		geneticAlgorithm.setPackedPopulation(options.m_packedPopulation);
+		geneticAlgorithm.setFixedCheckpointRecords(options.m_fixedCheckpoint);
+		geneticAlgorithm.setHallOfFameSize(options.m_hallOfFameSize);
+
+		if (options.m_archiveBudgetKB > 0 && !geneticAlgorithm.setHallOfFameMemoryBudget(static_cast<size_t>(options.m_archiveBudgetKB) * 1024, options.m_spillPath)) {
+			return 1;
+		}
+
+		geneticAlgorithm.setStopOnConvergence(options.m_stopOnConvergence);
+		geneticAlgorithm.setPlateauGenerations(options.m_plateauGenerations);
+		geneticAlgorithm.setIntegritySettings({ options.m_checkInterval, options.m_quarantine });
+
+		bool tracing = !options.m_tracePath.empty();
+		if (tracing) {
+
+#ifndef GA_ENABLE_PROFILING
+			std::cout << "Built without GA_ENABLE_PROFILING, the trace will be empty" << std::endl;
+#endif
+			Profiler::getProfiler().setCapturing(true);
+		}
+
+		bool resuming = !options.m_resumePath.empty();
+		bool seedingFromCorpus = !options.m_corpusPath.empty() && !resuming;
+
+		if (seedingFromCorpus && !geneticAlgorithm.setSeedCorpus(options.m_corpusPath)) {
+			return 1;
+		}
+
+		// Loaded even when resuming, the mutation pool samples from it too
+		bool usingModel = !options.m_modelPath.empty();
+		if (usingModel) {
+
+			const std::string& path = options.m_modelPath;
+			bool savedModel = path.size() > 5 && path.compare(path.size() - 5, 5, ".gmmk") == 0;
+
+			if (!(savedModel ? geneticAlgorithm.loadMarkovModel(path) : geneticAlgorithm.trainMarkovModel(path))) {
+				return 1;
+			}
+
+			if (!options.m_modelSavePath.empty() && !geneticAlgorithm.saveMarkovModel(options.m_modelSavePath)) {
+				return 1;
+			}
+		}
+
+		// The constructor already built a random population, replace it with a seeded one
+		if ((options.m_useSeed || seedingFromCorpus || usingModel) && !resuming) {
+
+			if (options.m_useSeed) {
+				geneticAlgorithm.setSeed(options.m_seed);
+			}
+
+			geneticAlgorithm.clearPhrasePool();
+		}
+
+		geneticAlgorithm.initializeAlgorithm(false);
+
+		// Restored after initializing so the saved fitness values aren't rescored
+		if (resuming) {
+
+			if (!geneticAlgorithm.loadCheckpoint(options.m_resumePath)) {
+
+				geneticAlgorithm.shutdownAlgorithm();
+				return 1;
+			}
+
+			// A seed on top of a checkpoint forks the run, every engine starts over from it
+			if (options.m_useSeed) {
+				geneticAlgorithm.setSeed(options.m_seed);
+			}
+		}
+		geneticAlgorithm.run();
+
+		if (tracing) {
+
+			Profiler::getProfiler().setCapturing(false);
+			Profiler::getProfiler().exportChromeTrace(options.m_tracePath);
+		}
+
+		// Only the archive is reported, it holds the best phrases from every generation not just the last one
+		const std::vector<Phrase*>& hallOfFame = geneticAlgorithm.getHallOfFame();
+
+		const ConvergenceStats& stats = geneticAlgorithm.getConvergenceStats();
+
+		std::cout << "Ran " << geneticAlgorithm.getTotalGenerations() << " generations";
+		if (options.m_timeBudgetMs > 0) {
+			std::cout << " in a " << options.m_timeBudgetMs << " ms budget";
+		}
+		std::cout << " (" << getConvergenceReasonName(geneticAlgorithm.getStopReason()) << ")" << std::endl;
+		std::cout << "Best: " << stats.m_bestFitness << "  Mean: " << stats.m_meanFitness;
+		std::cout << "  Diversity: " << stats.m_diversity << "  Duplicates: " << stats.m_duplicateRatio << std::endl;
+		geneticAlgorithm.getIntegrity().printReport(std::cout);
+
+		// Peak figures are what matter when sizing the population for a machine
+		MemoryTracker& tracker = MemoryTracker::getTracker();
+		std::cout << "Memory (current / peak KB):";
+		for (int tag = 0; tag < mem_Count; ++tag) {
+
+			MemoryTagStats memory = tracker.getStats(static_cast<MemoryTag>(tag));
+			if (memory.m_peakBytes == 0) {
+				continue;
+			}
+
+			std::cout << "  " << getMemoryTagName(static_cast<MemoryTag>(tag)) << " ";
+			std::cout << memory.m_currentBytes / 1024 << " / " << memory.m_peakBytes / 1024;
+		}
+		std::cout << "  Total " << tracker.getTotalStats().m_peakBytes / 1024 << " peak" << std::endl;
+
+		std::cout << "Hall of fame:" << std::endl;
+
+		uint32_t rank = 1;
+		bool exportFailed = false;
+		for (Phrase* phrase : hallOfFame) {
+
+			std::cout << "  #" << rank << "  Phrase ID: " << phrase->_phraseID;
+			std::cout << "  Fitness: " << phrase->_fitnessValue << std::endl;
+
+			// The entry may have been spilled, load it to get its notes back. A null phrase would
+			// export the active one under this entry's name, so a failed load skips the file
+			if (!options.m_exportPrefix.empty()) {
+
+				std::string filepath = options.m_exportPrefix + "_" + std::to_string(rank) + ".midi";
+
+				Phrase* entry = geneticAlgorithm.loadHallOfFameEntry(rank - 1);
+				if (entry) {
+					geneticAlgorithm.exportPhraseToMIDI(filepath, entry);
+				}
+				else {
+
+					std::cout << "Unable to load hall of fame entry #" << rank << ", " << filepath << " wasn't written" << std::endl;
+					exportFailed = true;
+				}
+			}
+
+			++rank;
+		}
+
+		if (!options.m_telemetryPath.empty() && !geneticAlgorithm.exportTelemetry(options.m_telemetryPath)) {
+
+			geneticAlgorithm.shutdownAlgorithm();
+			return 1;
+		}
+
+		if (!options.m_checkpointPath.empty() && !geneticAlgorithm.saveCheckpoint(options.m_checkpointPath)) {
+
+			geneticAlgorithm.shutdownAlgorithm();
+			return 1;
+		}
+
+		geneticAlgorithm.shutdownAlgorithm();
+		return exportFailed ? 1 : 0;
+	}
+
+} // namespace Genetics
@@ -0,0 +1,139 @@
+// Morgen Hyde
+
+#include "IntegrityMonitor.h"
+#include "GADefaultConfig.h"
+#include "Phrase.h"
+
+#include "Utility/Logger.h"
+
+#include <iomanip> // std::setw
+
+namespace Genetics {
+
+	IntegrityMonitor::IntegrityMonitor()
+		: m_settings(DefaultIntegritySettings), m_sampleCountdown(DefaultIntegritySettings.m_sampleInterval), m_checked(0), m_violations(0) {
+	}
+
+	IntegrityMonitor::~IntegrityMonitor() {
+
+		clearQuarantine();
+	}
+
+	void IntegrityMonitor::setOperators(const std::vector<const char*>& operatorNames) {
+
+		m_operators.clear();
+		m_operators.reserve(operatorNames.size());
+
+		for (const char* name : operatorNames) {
+			m_operators.push_back({ name, 0, {} });
+		}
+	}
+
+	void IntegrityMonitor::setSettings(const IntegritySettings& settings) {
+
+		m_settings = settings;
+		m_sampleCountdown = settings.m_sampleInterval;
+	}
+
+	bool IntegrityMonitor::sampleNext() {
+
+		if (m_settings.m_sampleInterval == 0) {
+			return false;
+		}
+
+		if (--m_sampleCountdown > 0) {
+			return false;
+		}
+
+		m_sampleCountdown = m_settings.m_sampleInterval;
+		return true;
+	}
+
+	bool IntegrityMonitor::check(Phrase* phrase, uint32_t operatorIndex) {
+
+		GA_Error errorCode = validatePhrase(phrase);
+
+		IntegrityOperatorStats* stats = (operatorIndex < m_operators.size()) ? &m_operators[operatorIndex] : nullptr;
+
+		++m_checked;
+		if (stats) {
+			++stats->m_checked;
+		}
+
+		if (errorCode == enm_noError) {
+			return true;
+		}
+
+		++m_violations;
+		if (stats && errorCode < enm_errorCount) {
+			++stats->m_violations[errorCode];
+		}
+
+		GA_LOG_ERROR("Integrity check failed after %s on phrase %u: %s", stats ? stats->m_name : "unknown operator",
+		             phrase->_phraseID, readErrorMessage(errorCode).c_str());
+		return false;
+	}
+
+	void IntegrityMonitor::quarantine(Phrase* phrase, const Phrase* replacement) {
+
+		// Only the first few are kept, an operator that's broken tends to break everything it touches
+		if (m_quarantined.size() < MaxQuarantinedPhrases) {
+			m_quarantined.push_back(new Phrase(*phrase));
+		}
+
+		if (!replacement) {
+			return;
+		}
+
+		// Nothing writes to the replacement's arrays without copying them first, so they can be shared.
+		// Its score comes along too, the evaluator won't score the same notes twice
+		phrase->shareGenome(*replacement);
+		phrase->_fitnessValue = replacement->_fitnessValue;
+		phrase->_fitnessKey = replacement->_fitnessKey;
+	}
+
+	void IntegrityMonitor::reset() {
+
+		for (IntegrityOperatorStats& stats : m_operators) {
+			stats = { stats.m_name, 0, {} };
+		}
+
+		m_sampleCountdown = m_settings.m_sampleInterval;
+		m_checked = 0;
+		m_violations = 0;
+
+		clearQuarantine();
+	}
+
+	void IntegrityMonitor::printReport(std::ostream& output) const {
+
+		output << "Integrity: " << m_violations << " violations in " << m_checked << " sampled children";
+		output << " (" << m_quarantined.size() << " quarantined)" << std::endl;
+
+		if (m_violations == 0) {
+			return;
+		}
+
+		output << std::setw(18) << "operator" << std::setw(10) << "checked" << std::setw(10) << "count";
+		output << std::setw(10) << "holes" << std::setw(10) << "overlaps" << std::setw(10) << "rests" << std::endl;
+
+		for (const IntegrityOperatorStats& stats : m_operators) {
+
+			output << std::setw(18) << stats.m_name << std::setw(10) << stats.m_checked;
+			output << std::setw(10) << stats.m_violations[enm_noteCountMismatch];
+			output << std::setw(10) << stats.m_violations[enm_noteLengthTooShort];
+			output << std::setw(10) << stats.m_violations[enm_noteLengthTooLong];
+			output << std::setw(10) << stats.m_violations[enm_restFound] << std::endl;
+		}
+	}
+
+	void IntegrityMonitor::clearQuarantine() {
+
+		for (Phrase* phrase : m_quarantined) {
+			delete phrase;
+		}
+
+		m_quarantined.clear();
+	}
+
+} // namespace Genetics
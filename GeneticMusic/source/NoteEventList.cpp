@@ -0,0 +1,55 @@
+// Morgen Hyde
+
+#include "NoteEventList.h"
+#include "Phrase.h"
+#include "PhraseShape.h"
+
+namespace Genetics {
+
+	NoteEventList::NoteEventList()
+		: m_noteCount(0) {
+	}
+
+	NoteEventList::~NoteEventList() {
+	}
+
+	void NoteEventList::build(const Phrase* phrase) {
+
+		uint32_t maxNotes = phrase->_numMeasures * phrase->_smallestSubdivision;
+		if (m_onsets.size() < maxNotes) {
+
+			m_pitches.resize(maxNotes);
+			m_durations.resize(maxNotes);
+			m_onsets.resize(maxNotes);
+		}
+
+		char* pitches = m_pitches.data();
+		char* durations = m_durations.data();
+		uint16_t* onsets = m_onsets.data();
+
+		// Same block scan as gatherNotes, all three fields are filled from each note found
+		m_noteCount = dispatchShape(phrase, [phrase, pitches, durations, onsets](auto shape) {
+
+			const uint32_t arrayLen = shape.maxNotes();
+			uint32_t noteCount = 0;
+
+			for (uint32_t base = 0; base < arrayLen; base += SlotBlockSize) {
+
+				uint32_t notes = noteMask(phrase->_melodicRhythm + base, std::min(SlotBlockSize, arrayLen - base));
+				while (notes != 0) {
+
+					uint32_t slot = base + lowestBit(notes);
+					notes &= notes - 1;
+
+					pitches[noteCount] = phrase->_melodicData[slot];
+					durations[noteCount] = phrase->_melodicRhythm[slot];
+					onsets[noteCount] = static_cast<uint16_t>(slot);
+					++noteCount;
+				}
+			}
+
+			return noteCount;
+		});
+	}
+
+} // namespace Genetics
@@ -0,0 +1,237 @@
+// Morgen Hyde
+
+#include "PackedGenome.h"
+#include "Phrase.h"
+#include "PhraseShape.h"
+
+#include <cstring> // std::memset, std::memcpy
+
+namespace Genetics {
+
+	// Bits go into a 64 bit accumulator and leave it a byte at a time, so the stream comes out the
+	// same on either byte order
+	struct PackedBitStream {
+
+		uint64_t m_bits;
+		uint32_t m_bitCount;
+		uint32_t m_byteIndex;
+	};
+
+	static __inline void writeBits(PackedBitStream& stream, char* output, uint32_t value, uint32_t width) {
+
+		stream.m_bits |= static_cast<uint64_t>(value) << stream.m_bitCount;
+		stream.m_bitCount += width;
+
+		while (stream.m_bitCount >= 8) {
+
+			output[stream.m_byteIndex++] = static_cast<char>(stream.m_bits & 0xFF);
+			stream.m_bits >>= 8;
+			stream.m_bitCount -= 8;
+		}
+	}
+
+	static __inline void flushBits(PackedBitStream& stream, char* output) {
+
+		if (stream.m_bitCount > 0) {
+			output[stream.m_byteIndex++] = static_cast<char>(stream.m_bits & 0xFF);
+		}
+
+		stream.m_bits = 0;
+		stream.m_bitCount = 0;
+	}
+
+	static __inline uint32_t readBits(PackedBitStream& stream, const char* input, uint32_t width) {
+
+		while (stream.m_bitCount < width) {
+
+			stream.m_bits |= static_cast<uint64_t>(static_cast<uint8_t>(input[stream.m_byteIndex++])) << stream.m_bitCount;
+			stream.m_bitCount += 8;
+		}
+
+		uint32_t value = static_cast<uint32_t>(stream.m_bits & ((1u << width) - 1));
+		stream.m_bits >>= width;
+		stream.m_bitCount -= width;
+
+		return value;
+	}
+
+	uint32_t getPackedGenomeSize(uint32_t noteCount, uint32_t chordCount) {
+
+		return (noteCount * PackedNoteBits + chordCount * PackedChordBits + 7) / 8;
+	}
+
+	bool packGenome(const Phrase* phrase, char* output, uint32_t& noteCount) {
+
+		const uint32_t chordCount = phrase->_numMeasures * 4;
+		PackedBitStream stream = { 0, 0, 0 };
+
+		// Found with the same block scan the shape kernels use, a pitch anywhere but a note start is
+		// data the packed form would drop
+		bool packable = dispatchShape(phrase, [phrase, output, &stream, &noteCount](auto shape) {
+
+			const uint32_t arrayLen = shape.maxNotes();
+			uint32_t expectedNote = 0;
+			noteCount = 0;
+
+			for (uint32_t base = 0; base < arrayLen; base += SlotBlockSize) {
+
+				uint32_t count = std::min(SlotBlockSize, arrayLen - base);
+				uint32_t notes = noteMask(phrase->_melodicRhythm + base, count);
+				uint32_t pitches = ~zeroMask(phrase->_melodicData + base, count) & blockBits(count);
+
+				if ((pitches & ~notes) != 0) {
+					return false;
+				}
+
+				while (notes != 0) {
+
+					uint32_t slot = base + lowestBit(notes);
+					notes &= notes - 1;
+
+					uint32_t pitch = static_cast<uint8_t>(phrase->_melodicData[slot]);
+					uint32_t length = static_cast<uint8_t>(phrase->_melodicRhythm[slot]);
+
+					// Every note has to start where the last one ended with a length the 3 bits can hold
+					uint32_t lengthLog = 0;
+					while ((1u << lengthLog) < length) {
+						++lengthLog;
+					}
+
+					if (slot != expectedNote || (1u << lengthLog) != length || lengthLog >= (1u << PackedLengthBits) || pitch >= (1u << PackedPitchBits)) {
+						return false;
+					}
+
+					writeBits(stream, output, pitch | (lengthLog << PackedPitchBits), PackedNoteBits);
+
+					expectedNote = slot + length;
+					++noteCount;
+				}
+			}
+
+			return expectedNote == arrayLen;
+		});
+
+		if (!packable) {
+			return false;
+		}
+
+		for (uint32_t chord = 0; chord < chordCount; ++chord) {
+
+			const Chord& current = phrase->_harmonicData[chord];
+			if (current._numeral > 7 || current._type > 3) {
+				return false;
+			}
+
+			writeBits(stream, output, current._numeral | (current._type << 3), PackedChordBits);
+		}
+
+		flushBits(stream, output);
+		return true;
+	}
+
+	void unpackGenome(const char* input, uint32_t noteCount, Phrase* phrase) {
+
+		const uint32_t maxNotes = phrase->_numMeasures * phrase->_smallestSubdivision;
+		const uint32_t chordCount = phrase->_numMeasures * 4;
+
+		std::memset(phrase->_melodicData, 0, maxNotes);
+		std::memset(phrase->_melodicRhythm, 0, maxNotes);
+
+		PackedBitStream stream = { 0, 0, 0 };
+
+		// Onsets come from the running total of the lengths. Notes that would land past the end are
+		// still read so the chords after them come out of the right bits
+		uint32_t slot = 0;
+		for (uint32_t note = 0; note < noteCount; ++note) {
+
+			uint32_t packed = readBits(stream, input, PackedNoteBits);
+			uint32_t length = 1u << (packed >> PackedPitchBits);
+
+			if (slot < maxNotes) {
+
+				phrase->_melodicData[slot] = static_cast<char>(packed & ((1u << PackedPitchBits) - 1));
+				phrase->_melodicRhythm[slot] = static_cast<char>(length);
+			}
+
+			slot += length;
+		}
+
+		for (uint32_t chord = 0; chord < chordCount; ++chord) {
+
+			uint32_t packed = readBits(stream, input, PackedChordBits);
+			phrase->_harmonicData[chord]._numeral = packed & 0x07;
+			phrase->_harmonicData[chord]._type = packed >> 3;
+		}
+	}
+
+	uint32_t getPackScratchSize(uint32_t measureCount, uint32_t subdivision) {
+
+		return getPackedGenomeSize(measureCount * subdivision, measureCount * 4);
+	}
+
+	bool packPhrase(Phrase* phrase, char* scratch) {
+
+		if (!phrase->_genome || phrase->isPacked()) {
+			return phrase->isPacked();
+		}
+
+		uint32_t noteCount = 0;
+		if (!packGenome(phrase, scratch, noteCount)) {
+			return false;
+		}
+
+		PhraseGenome* packed = PhraseGenome::create(getPackedGenomeSize(noteCount, phrase->_numMeasures * 4));
+		std::memcpy(packed->data(), scratch, packed->_byteCount);
+
+		// Same notes in a different form, so anything cached against them still holds
+		packed->_blockID = phrase->_genome->_blockID;
+
+		// Fitness, ID and note counts stay, only the storage changes
+		phrase->releaseArrays();
+
+		phrase->_genome = packed;
+		phrase->_arrayBytes = packed->_byteCount;
+		phrase->_packedNotes = noteCount;
+		return true;
+	}
+
+	void unpackPhrase(Phrase* phrase) {
+
+		if (!phrase->isPacked()) {
+			return;
+		}
+
+		// Copies of the phrase may still point at the packed block, they keep it alive
+		PhraseGenome* packed = phrase->_genome;
+		uint32_t noteCount = phrase->_packedNotes;
+
+		phrase->_genome = nullptr;
+		phrase->allocateArrays(phrase->_numMeasures, phrase->_smallestSubdivision);
+		unpackGenome(packed->data(), noteCount, phrase);
+		phrase->_genome->_blockID = packed->_blockID;
+
+		PhraseGenome::release(packed);
+	}
+
+	const Phrase* getGridView(const Phrase* phrase, Phrase& scratch) {
+
+		if (!phrase->isPacked()) {
+			return phrase;
+		}
+
+		if (!scratch._genome || scratch._numMeasures != phrase->_numMeasures || scratch._smallestSubdivision != phrase->_smallestSubdivision) {
+
+			scratch.releaseArrays();
+			scratch.allocateArrays(phrase->_numMeasures, phrase->_smallestSubdivision);
+		}
+
+		unpackGenome(phrase->_genome->data(), phrase->_packedNotes, &scratch);
+
+		scratch._melodicNotes = phrase->_melodicNotes;
+		scratch._harmonicNotes = phrase->_harmonicNotes;
+		scratch._fitnessValue = phrase->_fitnessValue;
+		scratch._phraseID = phrase->_phraseID;
+		return &scratch;
+	}
+
+} // namespace Genetics
@@ -1,135 +1,208 @@
-/*
-** Author  - Morgen Hyde
-** Project - MusicGenetics
-** Date    - 10 / 21 / 2019
-*/
-
-#include "PhrasePool.h"
-#include "GADefaultConfig.h"
-
-#include <iostream>  // std::cout
-#include <algorithm> // std::sort
-
-namespace Genetics {
-
-	unsigned Phrase::_phraseCount = 0;
-
-	unsigned Phrase::_numMeasures         = 0;
-	unsigned Phrase::_smallestSubdivision = 0;
-
-	PhrasePool::PhrasePool(PoolAllocator<Phrase>* poolAlloc, unsigned measureCount, unsigned subDivision)
-		: m_poolAllocator(poolAlloc), m_measureCount(measureCount), m_subDivision(subDivision) {
-
-		m_population.reserve(poolAlloc->capacity() - 1);
-	}
-
-	PhrasePool::~PhrasePool() {
-
-		for (Phrase* iter : m_population) {
-			m_poolAllocator->free(iter);
-		}
-		for (Phrase* iter : m_childPopulation) {
-			m_poolAllocator->free(iter);
-		}
-	}
-
-	Phrase* PhrasePool::AllocateChild() {
-
-		Phrase* newPhrase = m_poolAllocator->alloc();
-		if (newPhrase) {
-
-			// Allocate space for a note every 16th to make later operations easier
-			unsigned int maxNotes = m_measureCount * m_subDivision;
-
-			newPhrase->_melodicNotes  = 0;
-			newPhrase->_melodicData   = new char[maxNotes];
-			newPhrase->_melodicRhythm = new char[maxNotes];
-
-			newPhrase->_harmonicNotes = 0;
-			newPhrase->_harmonicData  = new Chord[m_measureCount * 4];
-
-			// Set all arrays to 0
-			std::memset(newPhrase->_melodicData,   0, maxNotes);
-			std::memset(newPhrase->_melodicRhythm, 0, maxNotes);
-
-			std::memset(newPhrase->_harmonicData,  0, m_measureCount * 4 * sizeof(Chord));
-
-			m_childPopulation.push_back(newPhrase);
-		}
-		return newPhrase;
-	}
-
-	unsigned PhrasePool::GetPhraseNumberOf(Phrase* phrase) const {
-
-		unsigned phraseNum = 1;
-		for (Phrase* iter : m_population)
-		{
-			if (iter == phrase) {
-				return phraseNum;
-			}
-
-			++phraseNum;
-		}
-
-		return 0;
-	}
-
-	void PhrasePool::DisplayRatings() const {
-
-		for (int i = 0; i < m_population.size(); ++i)
-		{
-			std::cout << "Measure #" << i + 1 << " has rating: ";
-			std::cout << m_population[i]->_fitnessValue << std::endl;
-		}
-	}
-
-	// Elitist Uses the best parents and their children first
-	void ElitistPrune::Merge(PoolAllocator<Phrase>* poolAlloc, PhraseVec& parents, PhraseVec& children) {
-
-		// Store the population size
-		uint32_t populationSize = static_cast<uint32_t>(parents.size());
-
-		// Add all the children to the parent vector and sort it in order of decreasing fitness values
-		parents.insert(parents.end(), children.begin(), children.end());
-		std::sort(parents.begin(), parents.end(), PhraseFitnessSorter());
-
-		children.clear();
-
-		// Remove elements till we're back at the correct size
-		while (parents.size() > populationSize) {
-
-			poolAlloc->free(parents.back());
-			parents.pop_back();
-		}
-
-	}
-
-	// Generational is a complete replacement of parents with children
-	void GenerationalPrune::Merge(PoolAllocator<Phrase>* poolAlloc, PhraseVec& parents, PhraseVec& children) {
-
-		// Free all the parents in the parent vector
-		for (Phrase* parent : parents) {
-
-			poolAlloc->free(parent);
-		}
-
-		// Clear the vector
-		parents.clear();
-
-		// Take each child and add to the parent vector
-		for (Phrase* child : children) {
-
-			parents.push_back(child);
-		}
-
-		// Clear the child vector
-		children.clear();
-	}
-
-	// Truncation just uses the best N members of the population regardless of child or parent status
-	void TruncationPrune::Merge(PoolAllocator<Phrase>* poolAlloc, PhraseVec& parents, PhraseVec& children) {
-
-
-	}
-
+/*
+** Author  - Morgen Hyde
+** Project - MusicGenetics
+** Date    - 10 / 21 / 2019
+*/
+
+#include "PhrasePool.h"
+#include "GADefaultConfig.h"
+#include "PackedGenome.h"
+#include "Utility/TaskScheduler.h"
+
+#include <iostream>  // std::cout
+#include <algorithm> // std::sort
+
+namespace Genetics {
+
+	// Packing one phrase is quick, chunks of them keep the scheduler overhead down
+	static constexpr uint32_t PackGrainSize = 64;
+
+	PhrasePool::PhrasePool(PoolAllocator<Phrase>* poolAlloc, unsigned measureCount, unsigned subDivision)
+		: m_poolAllocator(poolAlloc), m_heapValid(false), m_replacementEngine(std::random_device()()),
+		  m_lastPhraseID(0), m_measureCount(measureCount), m_subDivision(subDivision) {
+
+		m_population.reserve(poolAlloc->capacity() - 1);
+		m_packScratch.resize(getPackScratchSize(measureCount, subDivision));
+	}
+
+	PhrasePool::~PhrasePool() {
+
+		for (Phrase* iter : m_population) {
+			m_poolAllocator->free(iter);
+		}
+		for (Phrase* iter : m_childPopulation) {
+			m_poolAllocator->free(iter);
+		}
+	}
+
+	Phrase* PhrasePool::AllocateChild() {
+
+		Phrase* newPhrase = m_poolAllocator->alloc();
+		if (newPhrase) {
+
+			newPhrase->_melodicNotes  = 0;
+			newPhrase->_harmonicNotes = 0;
+			newPhrase->_phraseID = ++m_lastPhraseID;
+			newPhrase->allocateArrays(m_measureCount, m_subDivision);
+
+			m_childPopulation.push_back(newPhrase);
+		}
+		return newPhrase;
+	}
+
+	unsigned PhrasePool::GetPhraseNumberOf(Phrase* phrase) const {
+
+		unsigned phraseNum = 1;
+		for (Phrase* iter : m_population)
+		{
+			if (iter == phrase) {
+				return phraseNum;
+			}
+
+			++phraseNum;
+		}
+
+		return 0;
+	}
+
+	void PhrasePool::SortPopulation() {
+
+		std::sort(m_population.begin(), m_population.end(), PhraseFitnessSorter());
+		m_heapValid = false;
+	}
+
+	void PhrasePool::PackPopulation() {
+
+		uint32_t scratchSize = static_cast<uint32_t>(m_packScratch.size());
+		for (PhraseVec* phrases : { &m_population, &m_childPopulation }) {
+
+			PhraseVec& phraseVec = *phrases;
+			TaskScheduler::getScheduler().parallelFor(0, static_cast<uint32_t>(phraseVec.size()), PackGrainSize,
+				[&phraseVec, scratchSize](uint32_t first, uint32_t last) {
+
+				std::vector<char> scratch(scratchSize);
+				for (uint32_t i = first; i < last; ++i) {
+					packPhrase(phraseVec[i], scratch.data());
+				}
+			});
+		}
+	}
+
+	void PhrasePool::UnpackPopulation() {
+
+		for (PhraseVec* phrases : { &m_population, &m_childPopulation }) {
+
+			PhraseVec& phraseVec = *phrases;
+			TaskScheduler::getScheduler().parallelFor(0, static_cast<uint32_t>(phraseVec.size()), PackGrainSize,
+				[&phraseVec](uint32_t first, uint32_t last) {
+
+				for (uint32_t i = first; i < last; ++i) {
+					unpackPhrase(phraseVec[i]);
+				}
+			});
+		}
+	}
+
+	bool PhrasePool::PackPhrase(Phrase* phrase) {
+
+		return phrase && packPhrase(phrase, m_packScratch.data());
+	}
+
+	void PhrasePool::UnpackPhrase(Phrase* phrase) {
+
+		if (phrase) {
+			unpackPhrase(phrase);
+		}
+	}
+
+	void PhrasePool::ReleaseChildren() {
+
+		for (Phrase* child : m_childPopulation) {
+			m_poolAllocator->free(child);
+		}
+
+		m_childPopulation.clear();
+	}
+
+	void PhrasePool::DisplayRatings() const {
+
+		for (int i = 0; i < m_population.size(); ++i)
+		{
+			std::cout << "Measure #" << i + 1 << " has rating: ";
+			std::cout << m_population[i]->_fitnessValue << std::endl;
+		}
+	}
+
+	// Elitist Uses the best parents and their children first
+	void ElitistPrune::Merge(PoolAllocator<Phrase>* poolAlloc, PhraseVec& parents, PhraseVec& children) {
+
+		// Store the population size
+		uint32_t populationSize = static_cast<uint32_t>(parents.size());
+
+		// Add all the children to the parent vector and sort it in order of decreasing fitness values
+		parents.insert(parents.end(), children.begin(), children.end());
+		std::sort(parents.begin(), parents.end(), PhraseFitnessSorter());
+
+		children.clear();
+
+		// Remove elements till we're back at the correct size
+		while (parents.size() > populationSize) {
+
+			poolAlloc->free(parents.back());
+			parents.pop_back();
+		}
+
+	}
+
+	// Generational is a complete replacement of parents with children
+	void GenerationalPrune::Merge(PoolAllocator<Phrase>* poolAlloc, PhraseVec& parents, PhraseVec& children) {
+
+		// Free all the parents in the parent vector
+		for (Phrase* parent : parents) {
+
+			poolAlloc->free(parent);
+		}
+
+		// Clear the vector
+		parents.clear();
+
+		// Take each child and add to the parent vector
+		for (Phrase* child : children) {
+
+			parents.push_back(child);
+		}
+
+		// Clear the child vector
+		children.clear();
+	}
+
+	// Truncation just uses the best N members of the population regardless of child or parent status
+	void TruncationPrune::Merge(PoolAllocator<Phrase>* poolAlloc, PhraseVec& parents, PhraseVec& children) {
+
+
+	}
+
+	// The heap always has the worst member on top, so this is O(1)
+	uint32_t ReplaceWorst::SelectVictim(const FitnessHeap& heap, const PhraseVec& population, std::mt19937& engine) {
+
+		return heap.worstSlot();
+	}
+
+	// Sample a handful of members and replace the least fit of them
+	uint32_t ReverseTournamentReplace::SelectVictim(const FitnessHeap& heap, const PhraseVec& population, std::mt19937& engine) {
+
+		std::uniform_int_distribution<uint32_t> slotDistribution(0, static_cast<uint32_t>(population.size()) - 1);
+
+		uint32_t victim = slotDistribution(engine);
+		for (uint16_t i = 1; i < ReverseTournamentSize; ++i) {
+
+			uint32_t contender = slotDistribution(engine);
+			if (population[contender]->_fitnessValue < population[victim]->_fitnessValue) {
+				victim = contender;
+			}
+		}
+
+		return victim;
+	}
+
 } // namespace Genetics
\ No newline at end of file
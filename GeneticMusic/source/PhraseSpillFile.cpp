@@ -0,0 +1,109 @@
+// Morgen Hyde
+
+#include "PhraseSpillFile.h"
+#include "Checkpoint.h"
+#include "Phrase.h"
+
+#include <iostream> // std::cout
+#include <vector>
+#include <algorithm> // std::min
+
+namespace Genetics {
+
+	PhraseSpillFile::PhraseSpillFile()
+		: m_measureCount(0), m_subdivision(0), m_recordSize(0), m_fileSize(0) {
+	}
+
+	PhraseSpillFile::~PhraseSpillFile() {
+
+		close();
+	}
+
+	bool PhraseSpillFile::open(const std::string& filepath) {
+
+		close();
+
+		m_writer.open(filepath, std::ios::binary | std::ios::trunc);
+		if (!m_writer.is_open()) {
+
+			std::cout << "Unable to open spill file " << filepath << std::endl;
+			return false;
+		}
+
+		m_filepath = filepath;
+		m_measureCount = 0;
+		m_subdivision = 0;
+		m_recordSize = 0;
+		m_fileSize = 0;
+
+		return true;
+	}
+
+	void PhraseSpillFile::close() {
+
+		m_view.close();
+		if (m_writer.is_open()) {
+			m_writer.close();
+		}
+
+		m_fileSize = 0;
+	}
+
+	uint64_t PhraseSpillFile::append(const Phrase* phrase) {
+
+		if (!m_writer.is_open()) {
+			return InvalidSpillOffset;
+		}
+
+		if (m_recordSize == 0) {
+
+			m_measureCount = phrase->_numMeasures;
+			m_subdivision = phrase->_smallestSubdivision;
+			m_recordSize = getCheckpointRecordSize(m_measureCount, m_subdivision);
+		}
+		else if (phrase->_numMeasures != m_measureCount || phrase->_smallestSubdivision != m_subdivision) {
+			return InvalidSpillOffset;
+		}
+
+		std::vector<char> record(m_recordSize);
+		uint32_t recordSize = packPhraseRecord(phrase, m_measureCount, m_subdivision, record.data());
+
+		m_writer.write(record.data(), recordSize);
+		if (!m_writer.good()) {
+
+			std::cout << "Failed writing spill file " << m_filepath << std::endl;
+			return InvalidSpillOffset;
+		}
+
+		uint64_t offset = m_fileSize;
+		m_fileSize += recordSize;
+
+		return offset;
+	}
+
+	bool PhraseSpillFile::read(uint64_t offset, Phrase* phrase) {
+
+		if (offset >= m_fileSize || phrase->_numMeasures != m_measureCount || phrase->_smallestSubdivision != m_subdivision) {
+			return false;
+		}
+
+		// Written since the last mapping, push it out of the stream buffer and map the file again.
+		// Records vary in size, but none of them are bigger than m_recordSize or run past the end
+		uint64_t recordEnd = std::min<uint64_t>(offset + m_recordSize, m_fileSize);
+		if (recordEnd > m_view.size()) {
+
+			m_writer.flush();
+			if (!m_view.open(m_filepath) || recordEnd > m_view.size()) {
+				return false;
+			}
+		}
+
+		if (!checkPhraseRecord(m_view.data() + offset, m_view.size() - offset, m_measureCount, m_subdivision)) {
+			return false;
+		}
+
+		unpackPhraseRecord(m_view.data() + offset, m_measureCount, m_subdivision, phrase);
+		return true;
+	}
+
+} // namespace Genetics
@@ -0,0 +1,138 @@
+// Morgen Hyde
+
+#include "Telemetry.h"
+#include "Phrase.h"
+
+#include <fstream>  // std::ofstream
+#include <iostream> // std::cout
+#include <cmath>    // std::sqrt
+
+namespace Genetics {
+
+	TelemetryRecorder::TelemetryRecorder(uint32_t capacity)
+		: m_records(capacity > 0 ? capacity : 1), m_head(0), m_count(0) {
+	}
+
+	TelemetryRecorder::~TelemetryRecorder() {
+	}
+
+	void TelemetryRecorder::recordGeneration(const std::vector<Phrase*>& population, GenerationStats& stats) {
+
+		// Single pass fitness summary
+		double sum = 0.0, sumSquares = 0.0;
+		float minFitness = population.empty() ? 0.0f : population.front()->_fitnessValue;
+		float maxFitness = minFitness;
+
+		for (const Phrase* phrase : population) {
+
+			float fitness = phrase->_fitnessValue;
+			sum += fitness;
+			sumSquares += static_cast<double>(fitness) * fitness;
+
+			minFitness = (fitness < minFitness) ? fitness : minFitness;
+			maxFitness = (fitness > maxFitness) ? fitness : maxFitness;
+		}
+
+		double count = population.empty() ? 1.0 : static_cast<double>(population.size());
+		double mean = sum / count;
+		double variance = sumSquares / count - mean * mean;
+
+		stats.m_minFitness = minFitness;
+		stats.m_meanFitness = static_cast<float>(mean);
+		stats.m_maxFitness = maxFitness;
+		stats.m_stdDevFitness = static_cast<float>(std::sqrt(variance > 0.0 ? variance : 0.0));
+
+		m_records[m_head] = stats;
+		m_head = (m_head + 1) % capacity();
+		m_count = (m_count < capacity()) ? m_count + 1 : m_count;
+	}
+
+	void TelemetryRecorder::clear() {
+
+		m_head = 0;
+		m_count = 0;
+	}
+
+	const GenerationStats& TelemetryRecorder::getRecord(uint32_t index) const {
+
+		// When the buffer has wrapped the oldest record sits at the write head
+		uint32_t oldest = (m_count < capacity()) ? 0 : m_head;
+		return m_records[(oldest + index) % capacity()];
+	}
+
+	const GenerationStats* TelemetryRecorder::getLatest() const {
+
+		if (m_count == 0) {
+			return nullptr;
+		}
+
+		return &m_records[(m_head + capacity() - 1) % capacity()];
+	}
+
+	bool TelemetryRecorder::exportToFile(const std::string& filepath) const {
+
+		size_t extension = filepath.rfind('.');
+		if (extension != std::string::npos && filepath.compare(extension, std::string::npos, ".csv") == 0) {
+			return exportCSV(filepath);
+		}
+
+		return exportBinary(filepath);
+	}
+
+	bool TelemetryRecorder::exportCSV(const std::string& filepath) const {
+
+		std::ofstream csvFile(filepath);
+		if (!csvFile.is_open()) {
+
+			std::cout << "Unable to open telemetry file " << filepath << std::endl;
+			return false;
+		}
+
+		csvFile << "generation,min_fitness,mean_fitness,max_fitness,stddev_fitness,unique_genomes,";
+		csvFile << "children,generation_ms,children_per_sec,";
+		csvFile << "selection_ms,breeding_ms,mutation_ms,assessment_ms,merge_ms,packing_ms,";
+		csvFile << "allocator_used,allocator_capacity\n";
+
+		for (uint32_t i = 0; i < m_count; ++i) {
+
+			const GenerationStats& record = getRecord(i);
+
+			csvFile << record.m_generation << ',' << record.m_minFitness << ',' << record.m_meanFitness << ',';
+			csvFile << record.m_maxFitness << ',' << record.m_stdDevFitness << ',' << record.m_uniqueGenomes << ',';
+			csvFile << record.m_childrenProduced << ',' << record.m_generationMs << ',' << record.m_childrenPerSecond << ',';
+
+			for (uint32_t stage = 0; stage < stage_Count; ++stage) {
+				csvFile << record.m_stageMs[stage] << ',';
+			}
+
+			csvFile << record.m_allocatorUsed << ',' << record.m_allocatorCapacity << '\n';
+		}
+
+		return true;
+	}
+
+	bool TelemetryRecorder::exportBinary(const std::string& filepath) const {
+
+		std::ofstream binaryFile(filepath, std::ios::binary);
+		if (!binaryFile.is_open()) {
+
+			std::cout << "Unable to open telemetry file " << filepath << std::endl;
+			return false;
+		}
+
+		TelemetryFileHeader header = { { 'G', 'M', 'T', 'L' }, TelemetryFileVersion, sizeof(GenerationStats), m_count };
+		binaryFile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+		// At most two contiguous runs depending on whether the ring has wrapped
+		uint32_t oldest = (m_count < capacity()) ? 0 : m_head;
+		uint32_t firstRun = (oldest + m_count <= capacity()) ? m_count : capacity() - oldest;
+
+		binaryFile.write(reinterpret_cast<const char*>(&m_records[oldest]), firstRun * sizeof(GenerationStats));
+		if (firstRun < m_count) {
+			binaryFile.write(reinterpret_cast<const char*>(&m_records[0]), (m_count - firstRun) * sizeof(GenerationStats));
+		}
+
+		return binaryFile.good();
+	}
+
+} // namespace Genetics
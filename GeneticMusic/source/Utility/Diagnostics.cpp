@@ -1,131 +1,171 @@
-
-#include "Utility/Diagnostics.h"
-#include "Phrase.h"
-
-#include <iostream>
-
-
-namespace Genetics {
-
-	enum GA_ErrorCodes {
-
-		enm_noError = 0,
-		enm_noteCountMismatch,
-		enm_noteLengthTooShort,
-		enm_noteLengthTooLong,
-		enm_restFound,
-	};
-
-	std::string readErrorMessage(GA_Error errorCode) {
-
-		uint16_t errorNum = errorCode >> 16;
-
-		switch (errorCode) {
-
-		case enm_noError:
-			return "No error";
-
-		case enm_noteCountMismatch:
-			return "Expected note count differed from actual count";
-		
-		case enm_noteLengthTooShort:
-			return "Failed to find a note where one was expected (Hole in the measure)";
-
-		case enm_noteLengthTooLong:
-			return "Found a note before one was expected to occur (Overlapping notes)";
-
-		case enm_restFound:
-			return "Found a rest note where one wasn't expected";
-
-		default:
-			return "Unrecognized error code";
-		}
-	}
-
-	void printErrorMessage(GA_Error errorCode) {
-
-		std::cout << readErrorMessage(errorCode) << std::endl;
-	}
-
-
-	GA_Error validateNoteCount(Phrase* phrase) {
-
-		uint32_t arrayLen = Phrase::_numMeasures * Phrase::_smallestSubdivision;
-		uint32_t noteCount = 0;
-
-		for (uint32_t i = 0; i < arrayLen; ++i) {
-
-			if (phrase->_melodicRhythm[i] > 0) {
-				++noteCount;
-			}
-		}
-
-		if (noteCount == phrase->_melodicNotes) {
-			
-			return enm_noError;
-		}
-		else {
-
-			return enm_noteCountMismatch;
-		}
-	}
-
-	GA_Error validateNoteLengths(Phrase* phrase) {
-
-		uint32_t arrayLen = Phrase::_numMeasures * Phrase::_smallestSubdivision;
-		uint32_t remainingIndices = 0;
-
-		for (uint32_t i = 0; i < arrayLen; ++i) {
-
-			// If we find a note
-			if (phrase->_melodicRhythm[i] != 0) {
-				
-				if (remainingIndices == 0) {
-
-					// Set the expected number of zeros in the array before we find another note
-					remainingIndices = phrase->_melodicRhythm[i] - 1;
-				}
-				else {
-
-					// Discovered a note where we didn't expect one, fail immediately
-					return enm_noteLengthTooLong;
-				}
-			}
-			// No note at this index
-			else {
-
-				// Did we expect to find a note here
-				if (remainingIndices == 0) {
-					
-					// Failed to find a note where we expected one
-					return enm_noteLengthTooShort;
-				}
-				else {
-
-					// As expected just decrement the counter
-					--remainingIndices;
-				}
-			}
-		}
-
-		return enm_noError;
-	}
-
-	GA_Error validateRestOccurances(Phrase* phrase) {
-
-		uint32_t arrayLen = Phrase::_numMeasures * Phrase::_smallestSubdivision;
-		
-		for (uint32_t i = 0; i < arrayLen; ++i) {
-
-			// If the current pitch is a zero the current rhythm value should 
-			// also be zero or there's an error
-			if (phrase->_melodicData[i] == 0 && phrase->_melodicRhythm[i] != 0) {
-
-				return enm_restFound;
-			}
-		}
-
-		return enm_noError;
-	}
-
-} // namespace Genetics
+
+#include "Utility/Diagnostics.h"
+#include "Phrase.h"
+#include "PhraseShape.h"
+#include "Utility/Logger.h"
+
+#include <algorithm> // std::min
+
+
+namespace Genetics {
+
+	std::string readErrorMessage(GA_Error errorCode) {
+
+		uint16_t errorNum = errorCode >> 16;
+
+		switch (errorCode) {
+
+		case enm_noError:
+			return "No error";
+
+		case enm_noteCountMismatch:
+			return "Expected note count differed from actual count";
+		
+		case enm_noteLengthTooShort:
+			return "Failed to find a note where one was expected (Hole in the measure)";
+
+		case enm_noteLengthTooLong:
+			return "Found a note before one was expected to occur (Overlapping notes)";
+
+		case enm_restFound:
+			return "Found a rest note where one wasn't expected";
+
+		default:
+			return "Unrecognized error code";
+		}
+	}
+
+	void printErrorMessage(GA_Error errorCode) {
+
+		// Validation runs on every child in debug builds, only the failures are worth printing
+		if (errorCode != enm_noError) {
+			GA_LOG_ERROR("%s", readErrorMessage(errorCode).c_str());
+		}
+	}
+
+
+	// Validators work on the 16 slot blocks from PhraseShape.h. They're instantiated per shape, for
+	// the common ones the block loop has a constant trip count and every block takes the SSE2 path
+	template <typename Shape>
+	static GA_Error noteCountKernel(const Shape& shape, const Phrase* phrase) {
+
+		const uint32_t arrayLen = shape.maxNotes();
+		uint32_t noteCount = 0;
+
+		for (uint32_t base = 0; base < arrayLen; base += SlotBlockSize) {
+
+			uint32_t count = std::min(SlotBlockSize, arrayLen - base);
+			uint32_t notes = noteMask(phrase->_melodicRhythm + base, count);
+
+			noteCount += countBits(notes);
+		}
+
+		if (noteCount == phrase->_melodicNotes) {
+			
+			return enm_noError;
+		}
+		else {
+
+			return enm_noteCountMismatch;
+		}
+	}
+
+	template <typename Shape>
+	static GA_Error noteLengthKernel(const Shape& shape, const Phrase* phrase) {
+
+		const uint32_t arrayLen = shape.maxNotes();
+
+		// Rather than stepping through the empty slots one at a time, jump from note to note and
+		// check each one starts exactly where the previous one ended
+		uint32_t expectedNote = 0;
+
+		for (uint32_t base = 0; base < arrayLen; base += SlotBlockSize) {
+
+			uint32_t count = std::min(SlotBlockSize, arrayLen - base);
+			uint32_t notes = noteMask(phrase->_melodicRhythm + base, count);
+
+			while (notes != 0) {
+
+				uint32_t index = base + lowestBit(notes);
+				notes &= notes - 1;
+
+				// Discovered a note where we didn't expect one
+				if (index < expectedNote) {
+					return enm_noteLengthTooLong;
+				}
+
+				// Failed to find a note where we expected one (Hole in the measure)
+				if (index > expectedNote) {
+					return enm_noteLengthTooShort;
+				}
+
+				expectedNote = index + static_cast<unsigned char>(phrase->_melodicRhythm[index]);
+			}
+		}
+
+		// Ran out of notes before the end of the phrase
+		if (expectedNote < arrayLen) {
+			return enm_noteLengthTooShort;
+		}
+
+		return enm_noError;
+	}
+
+	template <typename Shape>
+	static GA_Error restKernel(const Shape& shape, const Phrase* phrase) {
+
+		const uint32_t arrayLen = shape.maxNotes();
+		
+		for (uint32_t base = 0; base < arrayLen; base += SlotBlockSize) {
+
+			uint32_t count = std::min(SlotBlockSize, arrayLen - base);
+
+			// If the current pitch is a zero the current rhythm value should 
+			// also be zero or there's an error
+			uint32_t restPitches = zeroMask(phrase->_melodicData + base, count);
+			uint32_t notes = noteMask(phrase->_melodicRhythm + base, count);
+
+			if ((restPitches & notes) != 0) {
+
+				return enm_restFound;
+			}
+		}
+
+		return enm_noError;
+	}
+
+	GA_Error validateNoteCount(Phrase* phrase) {
+
+		return dispatchShape(phrase, [phrase](auto shape) { return noteCountKernel(shape, phrase); });
+	}
+
+	GA_Error validateNoteLengths(Phrase* phrase) {
+
+		return dispatchShape(phrase, [phrase](auto shape) { return noteLengthKernel(shape, phrase); });
+	}
+
+	GA_Error validateRestOccurances(Phrase* phrase) {
+
+		return dispatchShape(phrase, [phrase](auto shape) { return restKernel(shape, phrase); });
+	}
+
+	GA_Error validatePhrase(Phrase* phrase) {
+
+		// Dispatched once for all three checks
+		return dispatchShape(phrase, [phrase](auto shape) {
+
+			GA_Error errorCode = noteCountKernel(shape, phrase);
+			if (errorCode != enm_noError) {
+				return errorCode;
+			}
+
+			errorCode = noteLengthKernel(shape, phrase);
+			if (errorCode != enm_noError) {
+				return errorCode;
+			}
+
+			return restKernel(shape, phrase);
+		});
+	}
+
+} // namespace Genetics
@@ -0,0 +1,97 @@
+// Morgen Hyde
+
+#include "Utility/DirectoryListing.h"
+
+#if defined(_WIN32)
+	#define WIN32_LEAN_AND_MEAN
+	#define NOMINMAX
+	#include <Windows.h>
+#else
+	#include <dirent.h>
+	#include <sys/stat.h>
+#endif
+
+#include <algorithm> // std::sort
+#include <cctype>    // std::tolower
+#include <iostream>  // std::cout
+
+namespace Genetics {
+
+	static bool hasExtension(const std::string& filename, const std::vector<std::string>& extensions) {
+
+		for (const std::string& extension : extensions) {
+
+			if (filename.size() <= extension.size()) {
+				continue;
+			}
+
+			size_t offset = filename.size() - extension.size();
+			bool matches = true;
+
+			for (size_t i = 0; i < extension.size() && matches; ++i) {
+				matches = std::tolower(static_cast<unsigned char>(filename[offset + i])) == std::tolower(static_cast<unsigned char>(extension[i]));
+			}
+
+			if (matches) {
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	bool listFiles(const std::string& directory, const std::vector<std::string>& extensions, std::vector<std::string>& filepaths) {
+
+		std::string prefix = directory;
+		if (!prefix.empty() && prefix.back() != '/' && prefix.back() != '\\') {
+			prefix += '/';
+		}
+
+		const size_t firstFound = filepaths.size();
+
+#if defined(_WIN32)
+		WIN32_FIND_DATAA findData;
+		HANDLE search = FindFirstFileA((prefix + "*").c_str(), &findData);
+		if (search == INVALID_HANDLE_VALUE) {
+
+			std::cout << "Unable to open directory " << directory << std::endl;
+			return false;
+		}
+
+		do {
+			if (!(findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) && hasExtension(findData.cFileName, extensions)) {
+				filepaths.push_back(prefix + findData.cFileName);
+			}
+		} while (FindNextFileA(search, &findData));
+
+		FindClose(search);
+#else
+		DIR* search = opendir(directory.empty() ? "." : directory.c_str());
+		if (!search) {
+
+			std::cout << "Unable to open directory " << directory << std::endl;
+			return false;
+		}
+
+		while (dirent* entry = readdir(search)) {
+
+			if (!hasExtension(entry->d_name, extensions)) {
+				continue;
+			}
+
+			// d_type isn't filled in on every filesystem, stat says for certain
+			std::string filepath = prefix + entry->d_name;
+			struct stat info;
+			if (stat(filepath.c_str(), &info) == 0 && S_ISREG(info.st_mode)) {
+				filepaths.push_back(filepath);
+			}
+		}
+
+		closedir(search);
+#endif
+
+		std::sort(filepaths.begin() + firstFound, filepaths.end());
+		return true;
+	}
+
+} // namespace Genetics
@@ -0,0 +1,225 @@
+// Morgen Hyde
+
+#include "Utility/Logger.h"
+#include "Utility/TaskScheduler.h"
+#include "GADefaultConfig.h"
+
+#include <cstdio>  // std::vsnprintf, std::fputs, std::fflush
+#include <cstring> // std::strrchr
+
+namespace Genetics {
+
+	static_assert((LogQueueCapacity & (LogQueueCapacity - 1)) == 0, "LogQueueCapacity must be a power of two");
+
+	const char* getLogLevelName(LogLevel level) {
+
+		switch (level) {
+
+		case log_Trace:
+			return "TRACE";
+
+		case log_Debug:
+			return "DEBUG";
+
+		case log_Info:
+			return "INFO";
+
+		case log_Warning:
+			return "WARNING";
+
+		case log_Error:
+			return "ERROR";
+
+		default:
+			return "NONE";
+		}
+	}
+
+	// __FILE__ can carry the whole path depending on the compiler, the file name is plenty
+	static const char* stripPath(const char* file) {
+
+		const char* forward = std::strrchr(file, '/');
+		const char* backward = std::strrchr(file, '\\');
+
+		const char* separator = (forward > backward) ? forward : backward;
+		return separator ? separator + 1 : file;
+	}
+
+	LogSite::LogSite(const char* file, uint32_t line)
+		: m_file(file), m_line(line), m_windowStartNs(0), m_windowCount(0), m_suppressed(0) {
+	}
+
+	bool LogSite::admit(uint64_t nowNs) {
+
+		const uint64_t windowNs = static_cast<uint64_t>(LogRateWindowMs) * 1000000;
+
+		// Whoever notices the window has expired first starts the next one, everyone else
+		// just counts against it
+		uint64_t windowStart = m_windowStartNs.load(std::memory_order_relaxed);
+		if (nowNs - windowStart >= windowNs && m_windowStartNs.compare_exchange_strong(windowStart, nowNs, std::memory_order_relaxed)) {
+			m_windowCount.store(0, std::memory_order_relaxed);
+		}
+
+		if (m_windowCount.fetch_add(1, std::memory_order_relaxed) < LogRateLimit) {
+			return true;
+		}
+
+		m_suppressed.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+
+	Logger::Logger()
+		: m_records(new LogRecord[LogQueueCapacity]), m_mask(LogQueueCapacity - 1), m_writePosition(0), m_readPosition(0),
+		  m_dropped(0), m_totalDropped(0), m_level(log_Trace), m_running(true), m_epoch(std::chrono::steady_clock::now()) {
+
+		// Every slot starts out ready to be written on the first pass around the ring
+		for (uint32_t i = 0; i < LogQueueCapacity; ++i) {
+			m_records[i].m_sequence.store(i, std::memory_order_relaxed);
+		}
+
+		m_sinkThread = std::thread(&Logger::sinkLoop, this);
+	}
+
+	Logger::~Logger() {
+
+		m_running.store(false);
+		if (m_sinkThread.joinable()) {
+			m_sinkThread.join();
+		}
+	}
+
+	uint64_t Logger::now() const {
+
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_epoch).count();
+	}
+
+	void Logger::write(LogLevel level, LogSite& site, const char* format, ...) {
+
+		if (level < getLevel()) {
+			return;
+		}
+
+		uint64_t timeNs = now();
+		if (!site.admit(timeNs)) {
+			return;
+		}
+
+		va_list args;
+		va_start(args, format);
+		push(level, site, timeNs, site.takeSuppressed(), format, args);
+		va_end(args);
+	}
+
+	bool Logger::push(LogLevel level, const LogSite& site, uint64_t timeNs, uint32_t suppressed, const char* format, va_list args) {
+
+		uint64_t position = m_writePosition.load(std::memory_order_relaxed);
+		LogRecord* record = nullptr;
+
+		while (true) {
+
+			record = &m_records[position & m_mask];
+			int64_t difference = static_cast<int64_t>(record->m_sequence.load(std::memory_order_acquire)) - static_cast<int64_t>(position);
+
+			// Slot is free, try to claim it
+			if (difference == 0) {
+
+				if (m_writePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+					break;
+				}
+			}
+			// The sink hasn't gotten to this slot yet, the queue is full. Dropping beats stalling the caller
+			else if (difference < 0) {
+
+				m_dropped.fetch_add(1, std::memory_order_relaxed);
+				m_totalDropped.fetch_add(1, std::memory_order_relaxed);
+				return false;
+			}
+			// Another producer claimed it first, catch up and try again
+			else {
+				position = m_writePosition.load(std::memory_order_relaxed);
+			}
+		}
+
+		record->m_level = level;
+		record->m_threadIndex = TaskScheduler::getThreadIndex();
+		record->m_timeNs = timeNs;
+		record->m_file = site.m_file;
+		record->m_line = site.m_line;
+		record->m_suppressed = suppressed;
+		std::vsnprintf(record->m_message, MessageLength, format, args);
+
+		// Publish after the record is filled in so the sink never reads a partial message
+		record->m_sequence.store(position + 1, std::memory_order_release);
+		return true;
+	}
+
+	bool Logger::printNext() {
+
+		uint64_t position = m_readPosition.load(std::memory_order_relaxed);
+		LogRecord& record = m_records[position & m_mask];
+
+		if (record.m_sequence.load(std::memory_order_acquire) != position + 1) {
+			return false;
+		}
+
+		char line[MessageLength + 128];
+		int length = std::snprintf(line, sizeof(line), "[%9.3f][%s][T%u] %s:%u %s", record.m_timeNs / 1e9, getLogLevelName(record.m_level),
+		                           record.m_threadIndex, stripPath(record.m_file), record.m_line, record.m_message);
+
+		if (record.m_suppressed > 0 && length > 0 && length < static_cast<int>(sizeof(line))) {
+			std::snprintf(line + length, sizeof(line) - length, " (%u similar suppressed)", record.m_suppressed);
+		}
+
+		// stdio rather than std::cout, the stream's formatting state isn't safe to share with the main thread
+		std::fputs(line, stdout);
+		std::fputc('\n', stdout);
+
+		// Hand the slot back to the producers for the next pass around the ring
+		record.m_sequence.store(position + m_mask + 1, std::memory_order_release);
+		m_readPosition.store(position + 1, std::memory_order_release);
+
+		return true;
+	}
+
+	void Logger::printDropped() {
+
+		uint32_t dropped = m_dropped.exchange(0, std::memory_order_relaxed);
+		if (dropped > 0) {
+			std::fprintf(stdout, "[Logger] %u messages dropped, queue was full\n", dropped);
+		}
+	}
+
+	void Logger::flush() {
+
+		// Anything claimed before this point will be published shortly, wait for the sink to print it
+		uint64_t target = m_writePosition.load(std::memory_order_acquire);
+		while (m_readPosition.load(std::memory_order_acquire) < target && m_running.load()) {
+			std::this_thread::yield();
+		}
+	}
+
+	void Logger::sinkLoop() {
+
+		while (m_running.load()) {
+
+			bool printed = false;
+			while (printNext()) {
+				printed = true;
+			}
+
+			printDropped();
+
+			if (printed) {
+				std::fflush(stdout);
+			}
+
+			std::this_thread::sleep_for(std::chrono::milliseconds(LogSinkIntervalMs));
+		}
+
+		// Final drain so nothing written before shutdown is lost
+		while (printNext()) {}
+		printDropped();
+		std::fflush(stdout);
+	}
+
+} // namespace Genetics
@@ -0,0 +1,119 @@
+// Morgen Hyde
+
+#include "Utility/MappedFile.h"
+
+#if defined(_WIN32)
+	#define WIN32_LEAN_AND_MEAN
+	#define NOMINMAX
+	#include <Windows.h>
+#else
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <fcntl.h>
+	#include <unistd.h>
+#endif
+
+#include <iostream> // std::cout
+
+namespace Genetics {
+
+	MappedFile::MappedFile()
+		: m_data(nullptr), m_size(0) {
+	}
+
+	MappedFile::~MappedFile() {
+
+		close();
+	}
+
+	bool MappedFile::open(const std::string& filepath) {
+
+		close();
+
+		// The view keeps the mapping alive on both platforms, so the handles are closed straight away
+#if defined(_WIN32)
+		// Shared for writing too so files that are still being appended to can be mapped
+		HANDLE file = CreateFileA(filepath.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (file == INVALID_HANDLE_VALUE) {
+
+			std::cout << "Unable to open " << filepath << std::endl;
+			return false;
+		}
+
+		LARGE_INTEGER fileSize;
+		if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+
+			std::cout << "Unable to map empty file " << filepath << std::endl;
+			CloseHandle(file);
+			return false;
+		}
+
+		HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		CloseHandle(file);
+
+		if (!mapping) {
+
+			std::cout << "Unable to map " << filepath << std::endl;
+			return false;
+		}
+
+		void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+		CloseHandle(mapping);
+
+		if (!view) {
+
+			std::cout << "Unable to map " << filepath << std::endl;
+			return false;
+		}
+
+		m_data = static_cast<const char*>(view);
+		m_size = static_cast<size_t>(fileSize.QuadPart);
+#else
+		int file = ::open(filepath.c_str(), O_RDONLY);
+		if (file < 0) {
+
+			std::cout << "Unable to open " << filepath << std::endl;
+			return false;
+		}
+
+		struct stat fileInfo;
+		if (fstat(file, &fileInfo) != 0 || fileInfo.st_size == 0) {
+
+			std::cout << "Unable to map empty file " << filepath << std::endl;
+			::close(file);
+			return false;
+		}
+
+		void* view = mmap(nullptr, static_cast<size_t>(fileInfo.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+		::close(file);
+
+		if (view == MAP_FAILED) {
+
+			std::cout << "Unable to map " << filepath << std::endl;
+			return false;
+		}
+
+		m_data = static_cast<const char*>(view);
+		m_size = static_cast<size_t>(fileInfo.st_size);
+#endif
+
+		return true;
+	}
+
+	void MappedFile::close() {
+
+		if (!m_data) {
+			return;
+		}
+
+#if defined(_WIN32)
+		UnmapViewOfFile(m_data);
+#else
+		munmap(const_cast<char*>(m_data), m_size);
+#endif
+
+		m_data = nullptr;
+		m_size = 0;
+	}
+
+} // namespace Genetics
@@ -0,0 +1,117 @@
+// Morgen Hyde
+
+#include "Utility/MemoryTracker.h"
+
+#include <cstdlib> // std::malloc, std::free
+
+namespace Genetics {
+
+	const char* getMemoryTagName(MemoryTag tag) {
+
+		switch (tag) {
+
+			case mem_PhrasePool:    return "Phrase pool";
+			case mem_PhraseArrays:  return "Phrase arrays";
+			case mem_SampleLibrary: return "Sample library";
+			case mem_AudioBuffers:  return "Audio buffers";
+			case mem_RuleStorage:   return "Rule storage";
+			case mem_UI:            return "UI";
+			default:                return "Unknown";
+		}
+	}
+
+	MemoryTracker::MemoryTracker() {
+
+		for (TagCounters& counters : m_tags) {
+
+			counters.m_currentBytes.store(0);
+			counters.m_peakBytes.store(0);
+			counters.m_allocations.store(0);
+		}
+
+		m_total.m_currentBytes.store(0);
+		m_total.m_peakBytes.store(0);
+		m_total.m_allocations.store(0);
+	}
+
+	void MemoryTracker::raisePeak(std::atomic<uint64_t>& peak, uint64_t value) {
+
+		// Another thread may raise it at the same time, only ever move it up
+		uint64_t current = peak.load(std::memory_order_relaxed);
+		while (value > current && !peak.compare_exchange_weak(current, value, std::memory_order_relaxed)) {}
+	}
+
+	void MemoryTracker::recordAlloc(MemoryTag tag, size_t bytes) {
+
+		TagCounters& counters = m_tags[tag];
+
+		uint64_t tagBytes = counters.m_currentBytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+		counters.m_allocations.fetch_add(1, std::memory_order_relaxed);
+		raisePeak(counters.m_peakBytes, tagBytes);
+
+		uint64_t totalBytes = m_total.m_currentBytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+		m_total.m_allocations.fetch_add(1, std::memory_order_relaxed);
+		raisePeak(m_total.m_peakBytes, totalBytes);
+	}
+
+	void MemoryTracker::recordFree(MemoryTag tag, size_t bytes) {
+
+		TagCounters& counters = m_tags[tag];
+
+		counters.m_currentBytes.fetch_sub(bytes, std::memory_order_relaxed);
+		counters.m_allocations.fetch_sub(1, std::memory_order_relaxed);
+
+		m_total.m_currentBytes.fetch_sub(bytes, std::memory_order_relaxed);
+		m_total.m_allocations.fetch_sub(1, std::memory_order_relaxed);
+	}
+
+	MemoryTagStats MemoryTracker::getStats(MemoryTag tag) const {
+
+		const TagCounters& counters = m_tags[tag];
+		return { counters.m_currentBytes.load(), counters.m_peakBytes.load(), counters.m_allocations.load() };
+	}
+
+	MemoryTagStats MemoryTracker::getTotalStats() const {
+
+		return { m_total.m_currentBytes.load(), m_total.m_peakBytes.load(), m_total.m_allocations.load() };
+	}
+
+	void MemoryTracker::resetPeaks() {
+
+		for (TagCounters& counters : m_tags) {
+			counters.m_peakBytes.store(counters.m_currentBytes.load());
+		}
+
+		m_total.m_peakBytes.store(m_total.m_currentBytes.load());
+	}
+
+	// ImGui doesn't pass the size back on free, so every block carries it in a small header.
+	// The header is padded to 16 bytes to keep the returned pointer aligned like malloc's
+	constexpr size_t UIHeaderSize = 16;
+
+	void* trackedUIAlloc(size_t bytes, void* userData) {
+
+		char* block = static_cast<char*>(std::malloc(bytes + UIHeaderSize));
+		if (!block) {
+			return nullptr;
+		}
+
+		*reinterpret_cast<size_t*>(block) = bytes;
+		MemoryTracker::getTracker().recordAlloc(mem_UI, bytes);
+
+		return block + UIHeaderSize;
+	}
+
+	void trackedUIFree(void* pointer, void* userData) {
+
+		if (!pointer) {
+			return;
+		}
+
+		char* block = static_cast<char*>(pointer) - UIHeaderSize;
+		MemoryTracker::getTracker().recordFree(mem_UI, *reinterpret_cast<size_t*>(block));
+
+		std::free(block);
+	}
+
+} // namespace Genetics
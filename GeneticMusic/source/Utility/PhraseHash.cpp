@@ -0,0 +1,47 @@
+// Morgen Hyde
+
+#include "Utility/PhraseHash.h"
+#include "Phrase.h"
+
+namespace Genetics {
+
+	constexpr uint64_t FNVOffsetBasis = 14695981039346656037ull;
+	constexpr uint64_t FNVPrime = 1099511628211ull;
+
+	uint64_t hashBytes(const void* data, uint32_t byteCount, uint64_t seed) {
+
+		const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
+
+		uint64_t hash = seed;
+		for (uint32_t i = 0; i < byteCount; ++i) {
+
+			hash ^= bytes[i];
+			hash *= FNVPrime;
+		}
+
+		return hash;
+	}
+
+	uint64_t hashPhraseGenome(const Phrase* phrase) {
+
+		uint32_t arrayLen = phrase->_numMeasures * phrase->_smallestSubdivision;
+
+		uint64_t hash = FNVOffsetBasis;
+
+		// Walk the notes rather than hashing the raw grid, slots between note starts can hold stale data
+		if (phrase->_melodicData && phrase->_melodicRhythm) {
+
+			for (uint32_t note = 0; note < arrayLen && phrase->_melodicRhythm[note] > 0; note += phrase->_melodicRhythm[note]) {
+
+				char noteData[2] = { phrase->_melodicData[note], phrase->_melodicRhythm[note] };
+				hash = hashBytes(noteData, sizeof(noteData), hash);
+			}
+		}
+		if (phrase->_harmonicData) {
+			hash = hashBytes(phrase->_harmonicData, phrase->_harmonicNotes * sizeof(Chord), hash);
+		}
+
+		return hash;
+	}
+
+} // namespace Genetics
@@ -0,0 +1,153 @@
+// Morgen Hyde
+
+#include "Utility/Profiler.h"
+#include "GADefaultConfig.h"
+
+#include <fstream>  // std::ofstream
+#include <iostream> // std::cout
+#include <iomanip>  // std::setprecision
+
+namespace Genetics {
+
+	// Gives the buffer back to the profiler when the owning thread exits
+	struct ProfileThreadHandle {
+
+		ProfileThreadHandle()
+			: m_buffer(nullptr) {
+		}
+
+		~ProfileThreadHandle() {
+
+			if (m_buffer) {
+				m_buffer->m_inUse.store(false);
+			}
+		}
+
+		ProfileThreadBuffer* m_buffer;
+	};
+
+	thread_local ProfileThreadHandle t_profileHandle;
+
+	ProfileThreadBuffer::ProfileThreadBuffer(uint32_t threadID, uint32_t capacity)
+		: m_events(capacity), m_count(0), m_dropped(0), m_inUse(true), m_threadID(threadID) {
+	}
+
+	Profiler::Profiler()
+		: m_capturing(false), m_epoch(std::chrono::steady_clock::now()) {
+	}
+
+	Profiler::~Profiler() {
+	}
+
+	void Profiler::setCapturing(bool capturing) {
+
+		if (capturing && !isCapturing()) {
+			clearBuffers();
+		}
+
+		m_capturing.store(capturing);
+	}
+
+	uint64_t Profiler::now() const {
+
+		// Offset by one so a real timestamp is never 0, which ProfileScope uses as "not recording"
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_epoch).count() + 1;
+	}
+
+	void Profiler::record(const char* name, uint64_t startNs, uint64_t endNs) {
+
+		ProfileThreadBuffer* buffer = t_profileHandle.m_buffer;
+		if (!buffer) {
+
+			buffer = acquireThreadBuffer();
+			t_profileHandle.m_buffer = buffer;
+		}
+
+		uint32_t index = buffer->m_count.load(std::memory_order_relaxed);
+		if (index >= buffer->m_events.size()) {
+
+			// Full buffers drop events instead of growing, growing would allocate in the hot path
+			buffer->m_dropped.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+
+		buffer->m_events[index] = { name, startNs, endNs - startNs };
+
+		// Publish after the event is written so the exporter never reads a partial record
+		buffer->m_count.store(index + 1, std::memory_order_release);
+	}
+
+	ProfileThreadBuffer* Profiler::acquireThreadBuffer() {
+
+		std::lock_guard<std::mutex> lock(m_bufferLock);
+
+		// Reuse a buffer whose thread has exited before allocating a new one
+		for (std::unique_ptr<ProfileThreadBuffer>& buffer : m_buffers) {
+
+			bool expected = false;
+			if (buffer->m_inUse.compare_exchange_strong(expected, true)) {
+				return buffer.get();
+			}
+		}
+
+		uint32_t threadID = static_cast<uint32_t>(m_buffers.size());
+		m_buffers.emplace_back(new ProfileThreadBuffer(threadID, ProfilerEventsPerThread));
+
+		return m_buffers.back().get();
+	}
+
+	void Profiler::clearBuffers() {
+
+		std::lock_guard<std::mutex> lock(m_bufferLock);
+
+		for (std::unique_ptr<ProfileThreadBuffer>& buffer : m_buffers) {
+
+			buffer->m_count.store(0);
+			buffer->m_dropped.store(0);
+		}
+	}
+
+	bool Profiler::exportChromeTrace(const std::string& filepath) {
+
+		std::ofstream traceFile(filepath);
+		if (!traceFile.is_open()) {
+
+			std::cout << "Unable to open trace file " << filepath << std::endl;
+			return false;
+		}
+
+		std::lock_guard<std::mutex> lock(m_bufferLock);
+
+		traceFile << std::fixed << std::setprecision(3);
+		traceFile << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+
+		bool first = true;
+		for (std::unique_ptr<ProfileThreadBuffer>& buffer : m_buffers) {
+
+			// Thread name metadata so the viewer labels each track
+			traceFile << (first ? "" : ",\n");
+			traceFile << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->m_threadID;
+			traceFile << ",\"args\":{\"name\":\"Thread " << buffer->m_threadID << "\"}}";
+			first = false;
+
+			uint32_t count = buffer->m_count.load(std::memory_order_acquire);
+			for (uint32_t i = 0; i < count; ++i) {
+
+				const ProfileEvent& event = buffer->m_events[i];
+
+				// Chrome trace timestamps are in microseconds
+				traceFile << ",\n{\"name\":\"" << event.m_name << "\",\"cat\":\"GA\",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->m_threadID;
+				traceFile << ",\"ts\":" << event.m_startNs / 1000.0 << ",\"dur\":" << event.m_durationNs / 1000.0 << "}";
+			}
+
+			uint32_t dropped = buffer->m_dropped.load();
+			if (dropped > 0) {
+				std::cout << "Profiler dropped " << dropped << " events on thread " << buffer->m_threadID << std::endl;
+			}
+		}
+
+		traceFile << "\n]}\n";
+		return traceFile.good();
+	}
+
+} // namespace Genetics
@@ -0,0 +1,320 @@
+// Morgen Hyde
+
+#include "Utility/TaskScheduler.h"
+
+#if defined(_WIN32)
+	#define WIN32_LEAN_AND_MEAN
+	#define NOMINMAX
+	#include <Windows.h>
+#elif defined(__linux__)
+	#include <pthread.h>
+	#include <sched.h>
+#endif
+
+namespace Genetics {
+
+	// Index of the worker running on this thread, 0 means "not one of ours"
+	thread_local uint32_t t_threadIndex = 0;
+
+	void pinThreadToCore(std::thread& thread, uint32_t core) {
+
+#if defined(_WIN32)
+		SetThreadAffinityMask(thread.native_handle(), DWORD_PTR(1) << core);
+#elif defined(__linux__)
+		cpu_set_t coreSet;
+		CPU_ZERO(&coreSet);
+		CPU_SET(core, &coreSet);
+		pthread_setaffinity_np(thread.native_handle(), sizeof(cpu_set_t), &coreSet);
+#else
+		// Pinning isn't supported on this platform, workers float
+		(void)thread; (void)core;
+#endif
+	}
+
+	TaskScheduler::TaskScheduler()
+		: m_queuedJobs(0), m_shuttingDown(false), m_pinThreads(false), m_users(0) {
+
+		// Slot 0 always exists so non-worker threads can submit before initialize is called
+		m_queues.emplace_back(new WorkQueue);
+	}
+
+	TaskScheduler::~TaskScheduler() {
+
+		shutdown();
+	}
+
+	void TaskScheduler::initialize(uint32_t workerCount, bool pinThreads) {
+
+		std::lock_guard<std::mutex> lock(m_lifecycleLock);
+
+		// Restarting with a new configuration
+		stopWorkers();
+		startWorkers(workerCount, pinThreads);
+	}
+
+	void TaskScheduler::shutdown() {
+
+		std::lock_guard<std::mutex> lock(m_lifecycleLock);
+		stopWorkers();
+	}
+
+	void TaskScheduler::acquire(uint32_t workerCount, bool pinThreads) {
+
+		std::lock_guard<std::mutex> lock(m_lifecycleLock);
+
+		// Later users share whatever the first one started, or whatever an explicit shutdown left
+		if (m_users++ == 0 && !isRunning()) {
+			startWorkers(workerCount, pinThreads);
+		}
+	}
+
+	void TaskScheduler::release() {
+
+		std::lock_guard<std::mutex> lock(m_lifecycleLock);
+
+		if (m_users > 0 && --m_users == 0) {
+			stopWorkers();
+		}
+	}
+
+	bool TaskScheduler::reconfigure(uint32_t workerCount, bool pinThreads) {
+
+		std::lock_guard<std::mutex> lock(m_lifecycleLock);
+
+		// Restarting under another user would pull the workers out from under its jobs
+		if (m_users > 1) {
+			return false;
+		}
+
+		stopWorkers();
+		startWorkers(workerCount, pinThreads);
+		return true;
+	}
+
+	void TaskScheduler::startWorkers(uint32_t workerCount, bool pinThreads) {
+
+		uint32_t hardwareThreads = std::thread::hardware_concurrency();
+		if (workerCount == 0) {
+			workerCount = (hardwareThreads > 1) ? hardwareThreads - 1 : 0;
+		}
+
+		m_pinThreads = pinThreads;
+		m_shuttingDown = false;
+
+		// One queue per worker on top of the shared slot 0 queue
+		while (m_queues.size() < workerCount + 1) {
+			m_queues.emplace_back(new WorkQueue);
+		}
+
+		m_workers.reserve(workerCount);
+		for (uint32_t i = 1; i <= workerCount; ++i) {
+
+			m_workers.emplace_back(&TaskScheduler::workerLoop, this, i);
+
+			// Leave core 0 to the main thread and wrap if we were asked for more workers than cores
+			if (m_pinThreads && hardwareThreads > 0) {
+				pinThreadToCore(m_workers.back(), i % hardwareThreads);
+			}
+		}
+	}
+
+	void TaskScheduler::stopWorkers() {
+
+		if (!isRunning()) {
+			return;
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(m_sleepLock);
+			m_shuttingDown = true;
+		}
+		m_wakeSignal.notify_all();
+
+		for (std::thread& worker : m_workers) {
+			worker.join();
+		}
+		m_workers.clear();
+
+		// Anything still queued gets finished on the calling thread so no group waits forever
+		while (runPendingJob(0)) {}
+
+		m_queues.resize(1);
+	}
+
+	uint32_t TaskScheduler::getThreadIndex() {
+
+		return t_threadIndex;
+	}
+
+	void TaskScheduler::submit(TaskGroup& group, Task task) {
+
+		// Without workers everything runs inline on the caller
+		if (!isRunning()) {
+
+			task();
+			return;
+		}
+
+		group.m_outstanding.fetch_add(1);
+
+		// Workers push onto their own deque, everyone else shares slot 0
+		uint32_t queueIndex = t_threadIndex;
+		if (queueIndex >= m_queues.size()) {
+			queueIndex = 0;
+		}
+
+		WorkQueue& queue = *m_queues[queueIndex];
+		{
+			std::lock_guard<std::mutex> lock(queue.m_lock);
+			queue.m_jobs.push_back({ std::move(task), &group });
+		}
+		m_queuedJobs.fetch_add(1);
+
+		// Take the sleep lock so a worker can't miss the wake between its check and its wait
+		{
+			std::lock_guard<std::mutex> lock(m_sleepLock);
+		}
+		m_wakeSignal.notify_one();
+	}
+
+	void TaskScheduler::wait(TaskGroup& group) {
+
+		uint32_t queueIndex = t_threadIndex;
+		if (queueIndex >= m_queues.size()) {
+			queueIndex = 0;
+		}
+
+		// Help out instead of blocking, this is what keeps nested fork/join from deadlocking
+		while (group.m_outstanding.load() > 0) {
+
+			if (!runPendingJob(queueIndex)) {
+				std::this_thread::yield();
+			}
+		}
+	}
+
+	void TaskScheduler::workerLoop(uint32_t workerIndex) {
+
+		t_threadIndex = workerIndex;
+
+		while (!m_shuttingDown.load()) {
+
+			if (runPendingJob(workerIndex)) {
+				continue;
+			}
+
+			// Nothing to do locally or to steal, sleep until a job is submitted
+			std::unique_lock<std::mutex> lock(m_sleepLock);
+			m_wakeSignal.wait(lock, [this]() { return m_shuttingDown.load() || m_queuedJobs.load() > 0; });
+		}
+
+		t_threadIndex = 0;
+	}
+
+	bool TaskScheduler::popJob(uint32_t queueIndex, Job& job) {
+
+		WorkQueue& queue = *m_queues[queueIndex];
+		std::lock_guard<std::mutex> lock(queue.m_lock);
+
+		if (queue.m_jobs.empty()) {
+			return false;
+		}
+
+		// Owner takes the newest job, it's the one most likely to still be in cache
+		job = std::move(queue.m_jobs.back());
+		queue.m_jobs.pop_back();
+		return true;
+	}
+
+	bool TaskScheduler::stealJob(uint32_t thiefIndex, Job& job) {
+
+		uint32_t queueCount = static_cast<uint32_t>(m_queues.size());
+		for (uint32_t offset = 1; offset < queueCount; ++offset) {
+
+			WorkQueue& victim = *m_queues[(thiefIndex + offset) % queueCount];
+			std::lock_guard<std::mutex> lock(victim.m_lock);
+
+			if (!victim.m_jobs.empty()) {
+
+				// Thieves take the oldest job, usually the largest remaining piece of work
+				job = std::move(victim.m_jobs.front());
+				victim.m_jobs.pop_front();
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	bool TaskScheduler::runPendingJob(uint32_t queueIndex) {
+
+		Job job;
+		if (!popJob(queueIndex, job) && !stealJob(queueIndex, job)) {
+			return false;
+		}
+
+		m_queuedJobs.fetch_sub(1);
+
+		// A task that throws still has to count as finished or its group waits forever, the
+		// exception goes back to whoever waits on the group instead of taking down this thread
+		try {
+			job.m_task();
+		}
+		catch (...) {
+
+			if (job.m_group) {
+				job.m_group->captureException(std::current_exception());
+			}
+		}
+		finishJob(job);
+
+		return true;
+	}
+
+	void TaskScheduler::finishJob(Job& job) {
+
+		if (job.m_group) {
+			job.m_group->m_outstanding.fetch_sub(1);
+		}
+	}
+
+	TaskGroup::TaskGroup()
+		: m_outstanding(0) {
+	}
+
+	TaskGroup::~TaskGroup() {
+
+		// Never let a group go out of scope while tasks still reference it. Nothing can be thrown
+		// from here, an exception nobody waited for is dropped
+		TaskScheduler::getScheduler().wait(*this);
+	}
+
+	void TaskGroup::run(Task task) {
+
+		TaskScheduler::getScheduler().submit(*this, std::move(task));
+	}
+
+	void TaskGroup::wait() {
+
+		TaskScheduler::getScheduler().wait(*this);
+
+		std::exception_ptr exception;
+		{
+			std::lock_guard<std::mutex> lock(m_exceptionLock);
+			std::swap(exception, m_exception);
+		}
+
+		if (exception) {
+			std::rethrow_exception(exception);
+		}
+	}
+
+	void TaskGroup::captureException(std::exception_ptr exception) {
+
+		std::lock_guard<std::mutex> lock(m_exceptionLock);
+		if (!m_exception) {
+			m_exception = exception;
+		}
+	}
+
+} // namespace Genetics
@@ -1,43 +1,54 @@
-/*
-** Author  - Morgen Hyde
-** Project - MusicGenetics
-** Date    - 9 / 29 / 2019
-*/
-
-// MiniProject Brief - The goal of this program is to use a genetic algorithm to
-// generate melodic phrases of music as MIDI files. The algorithm relies on human 
-// input to determine the "fitness" of any given musical phrase. See the research
-// sources document for the papers by Al Biles and Andrew R. Brown, Toby Gifford,
-// Robert Davidson, and Peter Langston for previous research this project uses
-
-#include "Graphics/UISystem.h"
-#include "Graphics/UIElementBuilder.h"
-
-#include "GAController.h"
-#include "GAControllerInterfaces.h"
-
-int main(int argc, char** argv) {
-
-	Genetics::GeneticAlgorithmController geneticAlgorithm;
-	Genetics::UISystem GUI;
-
-	// Create all the UI elements and pass them the appropriate interface elements
-	Genetics::UIElementBuilder::createUIElements(&geneticAlgorithm, &GUI);
-
-	// Initialize both the controller and UI
-	geneticAlgorithm.initializeAlgorithm();
-	GUI.initialize();
-
-	// Start main loop
-	while (GUI.windowIsOpen()) {
-
-		GUI.render();
-		geneticAlgorithm.updateAudioEngine();
-	}
-	
-	// Shut everything down
-	GUI.shutdown();
-	geneticAlgorithm.shutdownAlgorithm();
-
-	return 0;
-}
+/*
+** Author  - Morgen Hyde
+** Project - MusicGenetics
+** Date    - 9 / 29 / 2019
+*/
+
+// MiniProject Brief - The goal of this program is to use a genetic algorithm to
+// generate melodic phrases of music as MIDI files. The algorithm relies on human 
+// input to determine the "fitness" of any given musical phrase. See the research
+// sources document for the papers by Al Biles and Andrew R. Brown, Toby Gifford,
+// Robert Davidson, and Peter Langston for previous research this project uses
+
+#include "Graphics/UISystem.h"
+#include "Graphics/UIElementBuilder.h"
+
+#include "GAController.h"
+#include "GAControllerInterfaces.h"
+#include "HeadlessRunner.h"
+
+int main(int argc, char** argv) {
+
+	Genetics::HeadlessOptions options;
+	if (!Genetics::parseCommandLine(argc, argv, options)) {
+		return 1;
+	}
+
+	// Batch runs skip the window and audio entirely
+	if (options.m_headless) {
+		return Genetics::runHeadless(options);
+	}
+
+	Genetics::GeneticAlgorithmController geneticAlgorithm;
+	Genetics::UISystem GUI;
+
+	// Create all the UI elements and pass them the appropriate interface elements
+	Genetics::UIElementBuilder::createUIElements(&geneticAlgorithm, &GUI);
+
+	// Initialize both the controller and UI
+	geneticAlgorithm.initializeAlgorithm();
+	GUI.initialize();
+
+	// Start main loop
+	while (GUI.windowIsOpen()) {
+
+		GUI.render();
+		geneticAlgorithm.updateAudioEngine();
+	}
+	
+	// Shut everything down
+	GUI.shutdown();
+	geneticAlgorithm.shutdownAlgorithm();
+
+	return 0;
+}